@@ -11,3 +11,77 @@
 
 #include "BME680.hpp"
 
+#include "BME680_Registers.hpp"
+
+void BME680_Base::readBurst(uint16_t address, uint8_t *data, uint16_t count)
+{
+	for (uint16_t i = 0; i < count; i++)
+		data[i] = read8(address + i, 8);
+}
+
+void BME680_Base::writeBurst(uint16_t address, const uint8_t *data, uint16_t count)
+{
+	for (uint16_t i = 0; i < count; i++)
+		write(address + i, data[i], 8);
+}
+
+bool BME680_RegisterDump::isRestorable(uint16_t address)
+{
+	const BME680_RegisterInfo *reg = BME680_findRegister(address);
+	return reg && (reg->access & BME680_Access::WRITE) && address != BME680_Base::STATUS::__address;
+}
+
+bool BME680_RegisterDump::sameConfiguration(const BME680_RegisterDump &other) const
+{
+	typedef BME680_Base::Ctrl_meas Ctrl_meas;
+	for (uint16_t address = FIRST; address <= LAST; address++)
+	{
+		uint8_t mask = address == Ctrl_meas::__address ? (uint8_t)~Ctrl_meas::mode::mask : 0xff;
+		if (isRestorable(address) && ((get(address) ^ other.get(address)) & mask))
+			return false;
+	}
+	return true;
+}
+
+void BME680_Base::dumpRegisters(RegisterDump &dump)
+{
+	readBurst(RegisterDump::FIRST, dump.value, RegisterDump::SIZE);
+}
+
+uint16_t BME680_Base::restoreRegisters(const RegisterDump &dump)
+{
+	RegisterDump target = dump;
+	target.set(Ctrl_meas::__address, (uint8_t)(target.get(Ctrl_meas::__address) & ~Ctrl_meas::mode::mask));
+	
+	RegisterDump current;
+	dumpRegisters(current);
+	
+	uint16_t written = 0;
+	bool humidity = false, measurement = false;
+	uint16_t address = RegisterDump::FIRST;
+	while (address <= RegisterDump::LAST)
+	{
+		/* Find the next run of consecutive writable registers that differ */
+		uint16_t start = address;
+		while (start <= RegisterDump::LAST && !(RegisterDump::isRestorable(start) && target.get(start) != current.get(start)))
+			start++;
+		uint16_t end = start;
+		while (end <= RegisterDump::LAST && RegisterDump::isRestorable(end) && target.get(end) != current.get(end))
+			end++;
+		if (end > start)
+		{
+			writeBurst(start, &target.value[start - RegisterDump::FIRST], end - start);
+			written += end - start;
+			humidity = humidity || (start <= Ctrl_hum::__address && Ctrl_hum::__address < end);
+			measurement = measurement || (start <= Ctrl_meas::__address && Ctrl_meas::__address < end);
+		}
+		address = end + 1;
+	}
+	/* A Ctrl_hum change only takes effect after a write to Ctrl_meas */
+	if (humidity && !measurement)
+	{
+		write(Ctrl_meas::__address, target.get(Ctrl_meas::__address), 8);
+		written++;
+	}
+	return written;
+}
@@ -0,0 +1,43 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_BusStats.cpp
+ */
+
+#include "BME680_BusStats.hpp"
+
+BME680_CountingBus::BME680_CountingBus(BME680_Base &device, BME680_BusStats &busStats)
+	: dev(device), stats(busStats)
+{
+}
+
+uint8_t BME680_CountingBus::read8(uint16_t address, uint16_t n)
+{
+	stats.transactions++;
+	stats.bytes++;
+	return dev.read8(address, n);
+}
+
+void BME680_CountingBus::write(uint16_t address, uint8_t value, uint16_t n)
+{
+	stats.transactions++;
+	stats.bytes++;
+	dev.write(address, value, n);
+}
+
+void BME680_CountingBus::readBurst(uint16_t address, uint8_t *data, uint16_t count)
+{
+	stats.transactions++;
+	stats.bytes += count;
+	dev.readBurst(address, data, count);
+}
+
+void BME680_CountingBus::writeBurst(uint16_t address, const uint8_t *data, uint16_t count)
+{
+	stats.transactions++;
+	stats.bytes += count;
+	dev.writeBurst(address, data, count);
+}
@@ -0,0 +1,53 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_BusStats.hpp
+ */
+
+#ifndef BME680_BUSSTATS_HPP
+#define BME680_BUSSTATS_HPP
+
+#include <cinttypes>
+#include "BME680.hpp"
+
+/*
+ * Bus counters of one device, monotonically increasing.
+ * Errors and retries are only known below BME680_Base: they are counted by
+ * BME680_ResilientTransport, which fills all four counters when given the stats.
+ */
+struct BME680_BusStats
+{
+	uint64_t transactions; // bus transactions, a burst counts once
+	uint64_t bytes; // register bytes transferred
+	uint64_t errors; // failed transactions
+	uint64_t retries; // transactions repeated after an error
+
+	BME680_BusStats() : transactions(0), bytes(0), errors(0), retries(0) {}
+};
+
+/*
+ * Forwards all register accesses to another device and counts them.
+ * BME680_Base reports no failures, so only transactions and bytes are counted and
+ * errors and retries stay 0. For those, pass the stats to the BME680_ResilientTransport
+ * under the device instead; counting the same stats here too would count every
+ * transaction twice.
+ */
+class BME680_CountingBus : public BME680_Base
+{
+public:
+	BME680_CountingBus(BME680_Base &dev, BME680_BusStats &stats);
+
+	uint8_t read8(uint16_t address, uint16_t n=8);
+	void write(uint16_t address, uint8_t value, uint16_t n=8);
+	void readBurst(uint16_t address, uint8_t *data, uint16_t count);
+	void writeBurst(uint16_t address, const uint8_t *data, uint16_t count);
+
+private:
+	BME680_Base &dev;
+	BME680_BusStats &stats;
+};
+
+#endif
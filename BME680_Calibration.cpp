@@ -0,0 +1,58 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Calibration.cpp
+ */
+
+#include "BME680.hpp"
+#include "BME680_Calibration.hpp"
+
+/* Offsets into raw, coeff1 starts at 0x89, coeff2 at 0xE1 (offset 25), heat block at 0x00 (offset 41) */
+#define BME680_CAL_U16(lsb, msb) ((uint16_t)(((uint16_t)raw[msb] << 8) | raw[lsb]))
+
+void BME680_Calibration::read(BME680_Base &dev)
+{
+	dev.readBurst(COEFF1_ADDRESS, raw, COEFF1_SIZE);
+	dev.readBurst(COEFF2_ADDRESS, raw + COEFF1_SIZE, COEFF2_SIZE);
+	dev.readBurst(HEAT_ADDRESS, raw + COEFF1_SIZE + COEFF2_SIZE, HEAT_SIZE);
+	parse();
+}
+
+void BME680_Calibration::parse()
+{
+	const uint8_t *heat = raw + COEFF1_SIZE + COEFF2_SIZE;
+
+	par_t1 = BME680_CAL_U16(33, 34);
+	par_t2 = (int16_t)BME680_CAL_U16(1, 2);
+	par_t3 = (int8_t)raw[3];
+
+	par_p1 = BME680_CAL_U16(5, 6);
+	par_p2 = (int16_t)BME680_CAL_U16(7, 8);
+	par_p3 = (int8_t)raw[9];
+	par_p4 = (int16_t)BME680_CAL_U16(11, 12);
+	par_p5 = (int16_t)BME680_CAL_U16(13, 14);
+	par_p7 = (int8_t)raw[15];
+	par_p6 = (int8_t)raw[16];
+	par_p8 = (int16_t)BME680_CAL_U16(19, 20);
+	par_p9 = (int16_t)BME680_CAL_U16(21, 22);
+	par_p10 = raw[23];
+
+	par_h1 = (uint16_t)(((uint16_t)raw[27] << 4) | (raw[26] & 0x0f));
+	par_h2 = (uint16_t)(((uint16_t)raw[25] << 4) | (raw[26] >> 4));
+	par_h3 = (int8_t)raw[28];
+	par_h4 = (int8_t)raw[29];
+	par_h5 = (int8_t)raw[30];
+	par_h6 = raw[31];
+	par_h7 = (int8_t)raw[32];
+
+	par_gh1 = (int8_t)raw[37];
+	par_gh2 = (int16_t)BME680_CAL_U16(35, 36);
+	par_gh3 = (int8_t)raw[38];
+
+	res_heat_val = (int8_t)heat[0];
+	res_heat_range = (heat[2] & 0x30) >> 4;
+	range_sw_err = (int8_t)((int8_t)heat[4] & (int8_t)0xf0) / 16;
+}
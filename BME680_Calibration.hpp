@@ -0,0 +1,74 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Calibration.hpp
+ */
+
+#ifndef BME680_CALIBRATION_HPP
+#define BME680_CALIBRATION_HPP
+
+#include <cinttypes>
+#include "BME680_Core.hpp"
+
+/*
+ * Factory calibration parameters (trimming coefficients) of one device.
+ * They are stored in three register blocks which are not part of the register map:
+ *   0x89..0xA1  temperature, pressure and part of the gas coefficients
+ *   0xE1..0xF0  humidity, temperature and gas coefficients
+ *   0x00..0x04  res_heat_val, res_heat_range and range_sw_err
+ * The raw bytes are kept so that they can be cached and compared.
+ */
+struct BME680_Calibration
+{
+	static const uint16_t COEFF1_ADDRESS = 0x89;
+	static const uint16_t COEFF1_SIZE = 25;
+	static const uint16_t COEFF2_ADDRESS = 0xE1;
+	static const uint16_t COEFF2_SIZE = 16;
+	static const uint16_t HEAT_ADDRESS = 0x00;
+	static const uint16_t HEAT_SIZE = 5;
+	static const uint16_t RAW_SIZE = COEFF1_SIZE + COEFF2_SIZE + HEAT_SIZE;
+
+	uint8_t raw[RAW_SIZE]; // coeff1, coeff2 and heat blocks in this order
+
+	/* Temperature */
+	uint16_t par_t1;
+	int16_t par_t2;
+	int8_t par_t3;
+	/* Pressure */
+	uint16_t par_p1;
+	int16_t par_p2;
+	int8_t par_p3;
+	int16_t par_p4;
+	int16_t par_p5;
+	int8_t par_p6;
+	int8_t par_p7;
+	int16_t par_p8;
+	int16_t par_p9;
+	uint8_t par_p10;
+	/* Humidity */
+	uint16_t par_h1;
+	uint16_t par_h2;
+	int8_t par_h3;
+	int8_t par_h4;
+	int8_t par_h5;
+	uint8_t par_h6;
+	int8_t par_h7;
+	/* Gas heater */
+	int8_t par_gh1;
+	int16_t par_gh2;
+	int8_t par_gh3;
+	uint8_t res_heat_range;
+	int8_t res_heat_val;
+	/* Gas resistance range switching error */
+	int8_t range_sw_err;
+
+	/* Read the three register blocks in bursts and parse them */
+	void read(BME680_Base &dev);
+	/* Fill the parameters from raw */
+	void parse();
+};
+
+#endif
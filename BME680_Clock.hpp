@@ -0,0 +1,36 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Clock.hpp
+ */
+
+#ifndef BME680_CLOCK_HPP
+#define BME680_CLOCK_HPP
+
+#include <cinttypes>
+
+/* Derive from class BME680_Clock to provide time to the drivers (e.g. a virtual clock for tests) */
+class BME680_Clock
+{
+public:
+	virtual ~BME680_Clock() {}
+
+	/* Pure virtual functions that need to be implemented in derived class: */
+	virtual uint64_t micros() = 0;  // monotonic time in microseconds
+	virtual void sleep(uint32_t us) = 0;  // wait for at least us microseconds
+
+	uint32_t millis() { return (uint32_t)(micros() / 1000); }
+};
+
+/* POSIX monotonic clock */
+class BME680_SystemClock : public BME680_Clock
+{
+public:
+	uint64_t micros();
+	void sleep(uint32_t us);
+};
+
+#endif
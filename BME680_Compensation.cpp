@@ -0,0 +1,190 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Compensation.cpp
+ */
+
+#include "BME680_Compensation.hpp"
+
+const uint32_t BME680_gasLookup1[16] =
+{
+	2147483647u, 2147483647u, 2147483647u, 2147483647u, 2147483647u, 2126008810u, 2147483647u, 2130303777u,
+	2147483647u, 2147483647u, 2143188679u, 2136746228u, 2147483647u, 2126008810u, 2147483647u, 2147483647u
+};
+
+const uint32_t BME680_gasLookup2[16] =
+{
+	4096000000u, 2048000000u, 1024000000u, 512000000u, 255744255u, 127110228u, 64000000u, 32258064u,
+	16016016u, 8000000u, 4000000u, 2000000u, 1000000u, 500000u, 250000u, 125000u
+};
+
+uint32_t BME680_divide64(uint64_t n, uint32_t d)
+{
+	uint32_t hi = (uint32_t)(n >> 32);
+	uint32_t lo = (uint32_t)n;
+	if (hi >= d)
+		return 0xFFFFFFFF;
+	/* Restoring division, remainder in hi, quotient shifted into lo */
+	for (uint8_t i = 0; i < 32; i++)
+	{
+		uint32_t carry = hi >> 31;
+		hi = (hi << 1) | (lo >> 31);
+		lo <<= 1;
+		if (carry || hi >= d)
+		{
+			hi -= d;
+			lo |= 1;
+		}
+	}
+	return lo;
+}
+
+void BME680_GasTable::setup(int8_t range_sw_err)
+{
+	for (uint8_t r = 0; r < 16; r++)
+	{
+		var1[r] = (uint32_t)(((int64_t)(1340 + 5 * (int32_t)range_sw_err) * BME680_gasLookup1[r]) >> 16);
+		var3[r] = ((uint64_t)BME680_gasLookup2[r] * var1[r]) >> 9;
+	}
+}
+
+uint32_t BME680_GasTable::resistance(uint16_t adc, uint8_t range) const
+{
+	range &= 0x0f;
+	/* Positive for every adc: var1 > 16777216 for all ranges and range_sw_err */
+	uint32_t var2 = ((uint32_t)adc << 15) - 16777216u + var1[range];
+	uint64_t n = var3[range] + (var2 >> 1);
+#if BME680_SOFT_DIVIDE
+	return BME680_divide64(n, var2);
+#else
+	return (uint32_t)(n / var2);
+#endif
+}
+
+void BME680_PressureTerms::setup(const BME680_Calibration &cal, int32_t t_fine)
+{
+	int32_t var1 = (t_fine >> 1) - 64000;
+	int32_t var2 = ((((var1 >> 2) * (var1 >> 2)) >> 11) * (int32_t)cal.par_p6) >> 2;
+	var2 = var2 + ((var1 * (int32_t)cal.par_p5) << 1);
+	var2 = (var2 >> 2) + ((int32_t)cal.par_p4 << 16);
+	var1 = (((((var1 >> 2) * (var1 >> 2)) >> 13) * ((int32_t)cal.par_p3 << 5)) >> 3)
+		+ (((int32_t)cal.par_p2 * var1) >> 1);
+	var1 = var1 >> 18;
+	divisor = ((32768 + var1) * (int32_t)cal.par_p1) >> 15;
+	offset = var2 >> 12;
+}
+
+uint32_t BME680_PressureTerms::pressure(const BME680_Calibration &cal, uint32_t adc) const
+{
+	if (divisor == 0)
+		return 0;
+	int32_t p = 1048576 - (int32_t)adc;
+	p = (int32_t)((p - offset) * ((uint32_t)3125));
+	if (p >= 0x40000000)
+		p = (p / divisor) << 1;
+	else
+		p = (p << 1) / divisor;
+	int32_t var1 = ((int32_t)cal.par_p9 * (int32_t)(((p >> 3) * (p >> 3)) >> 13)) >> 12;
+	int32_t var2 = ((int32_t)(p >> 2) * (int32_t)cal.par_p8) >> 13;
+	int32_t var3 = ((int32_t)(p >> 8) * (int32_t)(p >> 8) * (int32_t)(p >> 8) * (int32_t)cal.par_p10) >> 17;
+	p = p + ((var1 + var2 + var3 + ((int32_t)cal.par_p7 << 7)) >> 4);
+	return (uint32_t)p;
+}
+
+void BME680_HumidityTerms::setup(const BME680_Calibration &cal, int32_t t_fine)
+{
+	int32_t temp_scaled = ((t_fine * 5) + 128) >> 8;
+	offset = (int32_t)cal.par_h1 * 16 + (((temp_scaled * (int32_t)cal.par_h3) / 100) >> 1);
+	scale = ((int32_t)cal.par_h2 * (((temp_scaled * (int32_t)cal.par_h4) / 100)
+		+ (((temp_scaled * ((temp_scaled * (int32_t)cal.par_h5) / 100)) >> 6) / 100) + (1 << 14))) >> 10;
+	quadratic = ((int32_t)cal.par_h6 << 7);
+	quadratic = (quadratic + ((temp_scaled * (int32_t)cal.par_h7) / 100)) >> 4;
+}
+
+uint32_t BME680_HumidityTerms::humidity(uint16_t adc) const
+{
+	int32_t var1 = (int32_t)adc - offset;
+	int32_t var3 = var1 * scale;
+	int32_t var5 = ((var3 >> 14) * (var3 >> 14)) >> 10;
+	int32_t var6 = (quadratic * var5) >> 1;
+	int32_t h = (((var3 + var6) >> 10) * 1000) >> 12;
+	if (h > 100000)
+		h = 100000;
+	else if (h < 0)
+		h = 0;
+	return (uint32_t)h;
+}
+
+BME680_Compensation::BME680_Compensation(const BME680_Calibration &calibration)
+	: cal(calibration), t_fine(0), tFineValid(false), gasSwErr(GAS_TABLE_EMPTY)
+{
+}
+
+int16_t BME680_Compensation::temperature(uint32_t adc)
+{
+	int64_t var1 = ((int32_t)adc >> 3) - ((int32_t)cal.par_t1 << 1);
+	int64_t var2 = (var1 * (int32_t)cal.par_t2) >> 11;
+	int64_t var3 = ((var1 >> 1) * (var1 >> 1)) >> 12;
+	var3 = (var3 * ((int32_t)cal.par_t3 << 4)) >> 14;
+	t_fine = (int32_t)(var2 + var3);
+	tFineValid = true;
+	return (int16_t)(((t_fine * 5) + 128) >> 8);
+}
+
+uint32_t BME680_Compensation::pressure(uint32_t adc) const
+{
+	BME680_PressureTerms terms;
+	terms.setup(cal, t_fine);
+	return terms.pressure(cal, adc);
+}
+
+uint32_t BME680_Compensation::humidity(uint16_t adc) const
+{
+	BME680_HumidityTerms terms;
+	terms.setup(cal, t_fine);
+	return terms.humidity(adc);
+}
+
+uint32_t BME680_Compensation::gasResistance(uint16_t adc, uint8_t range) const
+{
+	if (gasSwErr != cal.range_sw_err)
+	{
+		gas.setup(cal.range_sw_err);
+		gasSwErr = cal.range_sw_err;
+	}
+	return gas.resistance(adc, range);
+}
+
+uint8_t BME680_Compensation::heaterResistance(uint16_t target, int16_t ambient) const
+{
+	if (target > 400)
+		target = 400;
+	int32_t var1 = (((int32_t)ambient * cal.par_gh3) / 1000) * 256;
+	int32_t var2 = (cal.par_gh1 + 784) * (((((cal.par_gh2 + 154009) * target * 5) / 100) + 3276800) / 10);
+	int32_t var3 = var1 + (var2 / 2);
+	int32_t var4 = var3 / (cal.res_heat_range + 4);
+	int32_t var5 = (131 * cal.res_heat_val) + 65536;
+	int32_t res = (int32_t)(((var4 / var5) - 250) * 34);
+	return (uint8_t)((res + 50) / 100);
+}
+
+uint8_t BME680_Compensation::compensate(const BME680_RawSample &raw, BME680_Sample &sample)
+{
+	sample.valid = 0;
+	/* Short-circuit the math of every channel that holds the skipped/invalid marker */
+	if (raw.channels & (1 << BME680_Channel::TEMPERATURE))
+		sample.set(BME680_Channel::TEMPERATURE, temperature(raw.temperature) / 100.0);
+	if (tFineValid)
+	{
+		if (raw.channels & (1 << BME680_Channel::PRESSURE))
+			sample.set(BME680_Channel::PRESSURE, pressure(raw.pressure));
+		if (raw.channels & (1 << BME680_Channel::HUMIDITY))
+			sample.set(BME680_Channel::HUMIDITY, humidity(raw.humidity) / 1000.0);
+	}
+	if (raw.channels & (1 << BME680_Channel::GAS))
+		sample.set(BME680_Channel::GAS, gasResistance(raw.gas, raw.gasRange()));
+	return sample.valid;
+}
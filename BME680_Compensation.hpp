@@ -0,0 +1,114 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Compensation.hpp
+ */
+
+#ifndef BME680_COMPENSATION_HPP
+#define BME680_COMPENSATION_HPP
+
+#include <cinttypes>
+#include "BME680_Calibration.hpp"
+#include "BME680_Measurement.hpp"
+#include "BME680_Sample.hpp"
+
+/* Gas range tables of the Bosch reference driver, indexed by gas_range_r (const data, in flash on MCUs) */
+extern const uint32_t BME680_gasLookup1[16];
+extern const uint32_t BME680_gasLookup2[16];
+
+/* n / d for a quotient that fits 32 bits (0xFFFFFFFF otherwise), by shift and subtract */
+uint32_t BME680_divide64(uint64_t n, uint32_t d);
+
+/*
+ * 1 on cores without a divide instruction (ARMv6-M, ARMv7-A without IDIV, AVR), where the
+ * library's 64 bit division is a slow generic routine. Cores with a 32 bit divide use it.
+ */
+#if (defined(__arm__) && !defined(__ARM_FEATURE_IDIV)) || defined(__AVR__)
+#define BME680_SOFT_DIVIDE 1
+#else
+#define BME680_SOFT_DIVIDE 0
+#endif
+
+/*
+ * Terms of the gas resistance formula that only depend on the range and range_sw_err,
+ * precomputed per device. What is left per sample is one 64 by 32 bit division, done
+ * with BME680_divide64 where BME680_SOFT_DIVIDE is set.
+ */
+struct BME680_GasTable
+{
+	uint32_t var1[16]; // ((1340 + 5 * range_sw_err) * lookup1) >> 16
+	uint64_t var3[16]; // (lookup2 * var1) >> 9
+
+	void setup(int8_t range_sw_err);
+	uint32_t resistance(uint16_t adc, uint8_t range) const;
+};
+
+/*
+ * Terms of the pressure formula that only depend on t_fine. What is left per sample is the
+ * division by divisor and the polynomial in the pressure.
+ */
+struct BME680_PressureTerms
+{
+	int32_t divisor; // var1, 0 for an invalid calibration
+	int32_t offset; // var2 >> 12
+
+	void setup(const BME680_Calibration &cal, int32_t t_fine);
+	uint32_t pressure(const BME680_Calibration &cal, uint32_t adc) const;
+};
+
+/* Terms of the humidity formula that only depend on t_fine */
+struct BME680_HumidityTerms
+{
+	int32_t offset; // par_h1 * 16 and the linear temperature term
+	int32_t scale; // var2
+	int32_t quadratic; // var4
+
+	void setup(const BME680_Calibration &cal, int32_t t_fine);
+	uint32_t humidity(uint16_t adc) const;
+};
+
+/*
+ * Integer compensation of the raw ADC values (datasheet / Bosch reference driver).
+ * Pressure and humidity depend on t_fine, which is computed by temperature().
+ */
+class BME680_Compensation
+{
+public:
+	BME680_Compensation(const BME680_Calibration &cal);
+
+	/* Temperature in 0.01 degree Celsius, updates t_fine */
+	int16_t temperature(uint32_t adc);
+	/* Pressure in Pa */
+	uint32_t pressure(uint32_t adc) const;
+	/* Humidity in 0.001 % relative humidity */
+	uint32_t humidity(uint16_t adc) const;
+	/* Gas resistance in Ohm */
+	uint32_t gasResistance(uint16_t adc, uint8_t range) const;
+	/* Res_heat_x register value for a heater target in degree Celsius (max 400) at an ambient temperature */
+	uint8_t heaterResistance(uint16_t target, int16_t ambient) const;
+
+	int32_t tFine() const { return t_fine; }
+	bool hasTemperature() const { return tFineValid; }
+
+	/*
+	 * Compensate all channels flagged in raw.channels into sample (degree Celsius, Pa, %, Ohm).
+	 * Channels that were skipped or hold no valid gas result are not computed and stay invalid.
+	 * Without a temperature in this sample, P and H use the t_fine of the last one that had it,
+	 * and are invalid if there was none yet. Returns sample.valid.
+	 */
+	uint8_t compensate(const BME680_RawSample &raw, BME680_Sample &sample);
+
+private:
+	const BME680_Calibration &cal;
+	int32_t t_fine;
+	bool tFineValid;
+	/* Built on first use, the calibration may be read after construction */
+	mutable BME680_GasTable gas;
+	mutable int16_t gasSwErr; // range_sw_err the table was built for, GAS_TABLE_EMPTY before
+	static const int16_t GAS_TABLE_EMPTY = 0x7FFF;
+};
+
+#endif
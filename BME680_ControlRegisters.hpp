@@ -0,0 +1,327 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_ControlRegisters.hpp
+ */
+
+#ifndef BME680_CONTROLREGISTERS_HPP
+#define BME680_CONTROLREGISTERS_HPP
+
+#include <cinttypes>
+
+/*
+ * Control registers of BME680_Base: oversampling, IIR filter, power mode and gas conversion control.
+ * Include this header alone where only the constants are needed:
+ * BME680_ControlRegisters::Config::__address is BME680_Base::Config::__address.
+ */
+struct BME680_ControlRegisters
+{
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                            REG Config                                             *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Config:
+	 * 5.3.1.2 Enable SPI 3 wire mode
+	 * 5.3.2.4 IIR filter settings
+	 */
+	struct Config
+	{
+		static const uint16_t __address = 117;
+		
+		/* Bits unused_0: */
+		struct unused_0
+		{
+			static const uint8_t dflt = 0b000; // 3'b0
+			static const uint8_t mask = 0b11100000; // [5,6,7]
+		};
+		/* Bits filter: */
+		/*
+		 * IIR filter settings
+		 * IIR filter applies to temperature and pressure data but not to humidity and gas data.
+		 * The data coming from the ADC are filtered and then loaded into the data registers.
+		 * The temperature and pressure result registers are updated together at the same time
+		 * at the end of the measurement. IIR filter output resolution is 20 bits. The result
+		 * registers are reset to value 0x80000 when the temperature and/or pressure measurements
+		 * have been skipped (osrs_x=”000‟). The appropriate filter memory is kept unchanged
+		 * (the value from the last measurement is kept). When the appropriate OSRS register is
+		 * set back to nonzero, then the first value stored to the result registers are filtered.
+		 */
+		struct filter
+		{
+			static const uint8_t dflt = 0b000; // 3'b0
+			static const uint8_t mask = 0b00011100; // [2,3,4]
+		};
+		/* Bits unused_1: */
+		struct unused_1
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b00000010; // [1]
+		};
+		/* Bits spi_3w_en: */
+		/* Enable SPI 3 wire mode */
+		struct spi_3w_en
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b00000001; // [0]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                          REG Ctrl_meas                                           *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG Ctrl_meas:
+	 * 5.3.1.3 Select sensor power mode
+	 * 5.3.2.2 Temperature oversampling settings
+	 * 5.3.2.3 Pressure oversampling settings
+	 */
+	struct Ctrl_meas
+	{
+		static const uint16_t __address = 116;
+		
+		/* Bits osrs_t: */
+		/* Temperature oversampling settings  */
+		struct osrs_t
+		{
+			static const uint8_t dflt = 0b000; // 3'b0
+			static const uint8_t mask = 0b11100000; // [5,6,7]
+			static const uint8_t SKIPPED = 0b00; // output set to 0x8000
+			static const uint8_t X1 = 0b01; // oversampling ×1
+			static const uint8_t X2 = 0b10; // oversampling ×2
+			static const uint8_t X4 = 0b11; // oversampling ×4
+			static const uint8_t X8 = 0b100; // oversampling ×8
+			static const uint8_t X16 = 0b101; // oversampling ×16
+		};
+		/* Bits osrs_p: */
+		/* Pressure oversampling settings  */
+		struct osrs_p
+		{
+			static const uint8_t dflt = 0b000; // 3'b0
+			static const uint8_t mask = 0b00011100; // [2,3,4]
+			static const uint8_t SKIPPED = 0b00; // output set to 0x8000
+			static const uint8_t X1 = 0b01; // oversampling ×1
+			static const uint8_t X2 = 0b10; // oversampling ×2
+			static const uint8_t X4 = 0b11; // oversampling ×4
+			static const uint8_t X8 = 0b100; // oversampling ×8
+			static const uint8_t X16 = 0b101; // oversampling ×16
+		};
+		/* Bits mode: */
+		/* Select sensor power mode  */
+		struct mode
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b00000011; // [0,1]
+			static const uint8_t SLEEP = 0b00; // 
+			static const uint8_t FORCED = 0b01; // 
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                           REG Ctrl_hum                                            *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Ctrl_hum:
+	 * 5.3.1.1 SPI 3 wire interrupt enable
+	 * 5.3.2.1 Controls over sampling setting of humidity sensor
+	 */
+	struct Ctrl_hum
+	{
+		static const uint16_t __address = 114;
+		
+		/* Bits unused_0: */
+		struct unused_0
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b10000000; // [7]
+		};
+		/* Bits spi_3w_int_en: */
+		/*
+		 * New data interrupt can be enabled if the device is in SPI 3 wire mode and pi_3w_int_en=1.
+		 * The new data interrupt is then indicated on the SDO pad.
+		 */
+		struct spi_3w_int_en
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b01000000; // [6]
+		};
+		/* Bits unused_1: */
+		struct unused_1
+		{
+			static const uint8_t dflt = 0b000; // 3'b0
+			static const uint8_t mask = 0b00111000; // [3,4,5]
+		};
+		/* Bits osrs_h: */
+		/* Controls over sampling setting of humidity sensor  */
+		struct osrs_h
+		{
+			static const uint8_t dflt = 0b000; // 3'b0
+			static const uint8_t mask = 0b00000111; // [0,1,2]
+			static const uint8_t SKIPPED = 0b00; // output set to 0x8000
+			static const uint8_t X1 = 0b01; // oversampling ×1
+			static const uint8_t X2 = 0b10; // oversampling ×2
+			static const uint8_t X4 = 0b11; // oversampling ×4
+			static const uint8_t X8 = 0b100; // oversampling ×8
+			static const uint8_t X16 = 0b101; // oversampling ×16
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Ctrl_gas_1                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Ctrl_gas_1:
+	 * 5.3.3.5 Heater profile selection
+	 * 5.3.3.6 Run Gas
+	 */
+	struct Ctrl_gas_1
+	{
+		static const uint16_t __address = 113;
+		
+		/* Bits unused_0: */
+		struct unused_0
+		{
+			static const uint8_t dflt = 0b000; // 3'b0
+			static const uint8_t mask = 0b11100000; // [5,6,7]
+		};
+		/* Bits run_gas: */
+		/* The gas conversions are started only in appropriate mode if run_gas = ‘1’  */
+		struct run_gas
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b00010000; // [4]
+		};
+		/* Bits nb_conv: */
+		/* Indicates index of heater set point that will be used in forced mode  */
+		struct nb_conv
+		{
+			static const uint8_t dflt = 0b0000; // 4'b0
+			static const uint8_t mask = 0b00001111; // [0,1,2,3]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Ctrl_gas_0                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Ctrl_gas_0:
+	 * 5.3.3.4 Heater off
+	 */
+	struct Ctrl_gas_0
+	{
+		static const uint16_t __address = 112;
+		
+		/* Bits unused_0: */
+		struct unused_0
+		{
+			static const uint8_t dflt = 0b0000; // 4'b0
+			static const uint8_t mask = 0b11110000; // [4,5,6,7]
+		};
+		/* Bits heat_off: */
+		/* Turn off current injected to heater by setting bit to one  */
+		struct heat_off
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b00001000; // [3]
+			static const uint8_t HEAT_OFF = 0b1; // 
+			static const uint8_t HEAT_ON = 0b0; // 
+		};
+		/* Bits unused_1: */
+		struct unused_1
+		{
+			static const uint8_t dflt = 0b000; // 3'b0
+			static const uint8_t mask = 0b00000111; // [0,1,2]
+		};
+	};
+	
+};
+
+/* Set/get accessors of the control registers, D implements read8 and write */
+template <class D>
+class BME680_ControlAccess : public BME680_ControlRegisters
+{
+public:
+	/* Set register Config */
+	void setConfig(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Config::__address, value, 8);
+	}
+	
+	/* Get register Config */
+	uint8_t getConfig()
+	{
+		return static_cast<D *>(this)->read8(Config::__address, 8);
+	}
+	
+	/* Set register Ctrl_meas */
+	void setCtrl_meas(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Ctrl_meas::__address, value, 8);
+	}
+	
+	/* Get register Ctrl_meas */
+	uint8_t getCtrl_meas()
+	{
+		return static_cast<D *>(this)->read8(Ctrl_meas::__address, 8);
+	}
+	
+	/* Set register Ctrl_hum */
+	void setCtrl_hum(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Ctrl_hum::__address, value, 8);
+	}
+	
+	/* Get register Ctrl_hum */
+	uint8_t getCtrl_hum()
+	{
+		return static_cast<D *>(this)->read8(Ctrl_hum::__address, 8);
+	}
+	
+	/* Set register Ctrl_gas_1 */
+	void setCtrl_gas_1(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Ctrl_gas_1::__address, value, 8);
+	}
+	
+	/* Get register Ctrl_gas_1 */
+	uint8_t getCtrl_gas_1()
+	{
+		return static_cast<D *>(this)->read8(Ctrl_gas_1::__address, 8);
+	}
+	
+	/* Set register Ctrl_gas_0 */
+	void setCtrl_gas_0(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Ctrl_gas_0::__address, value, 8);
+	}
+	
+	/* Get register Ctrl_gas_0 */
+	uint8_t getCtrl_gas_0()
+	{
+		return static_cast<D *>(this)->read8(Ctrl_gas_0::__address, 8);
+	}
+};
+
+#endif
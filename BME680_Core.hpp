@@ -0,0 +1,46 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Core.hpp
+ */
+
+#ifndef BME680_CORE_HPP
+#define BME680_CORE_HPP
+
+#include <cinttypes>
+
+/*
+ * Lightweight core of the register layer for headers that only pass a device around
+ * or keep a register snapshot. Include BME680.hpp where the registers are accessed,
+ * or one of the register headers (BME680_StatusRegisters.hpp, BME680_ControlRegisters.hpp,
+ * BME680_HeaterRegisters.hpp, BME680_DataRegisters.hpp) where only their constants are used.
+ */
+
+class BME680_Base;
+
+/*
+ * Snapshot of the configuration registers Idac_heat_0 (80) to Config (117):
+ * heater current, resistance and wait time of all steps and the control registers.
+ * Also known as BME680_Base::RegisterDump.
+ */
+struct BME680_RegisterDump
+{
+	static const uint16_t FIRST = 80;
+	static const uint16_t LAST = 117;
+	static const uint16_t SIZE = LAST - FIRST + 1;
+	
+	uint8_t value[SIZE];
+	
+	uint8_t get(uint16_t address) const { return value[address - FIRST]; }
+	void set(uint16_t address, uint8_t v) { value[address - FIRST] = v; }
+	
+	/* Register exists, is writable and is not the SPI page select */
+	static bool isRestorable(uint16_t address);
+	/* Same configuration as other, ignoring the Ctrl_meas mode bits */
+	bool sameConfiguration(const BME680_RegisterDump &other) const;
+};
+
+#endif
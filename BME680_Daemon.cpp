@@ -0,0 +1,576 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Daemon.cpp
+ */
+
+#include <cstring>
+#include <cerrno>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "BME680.hpp"
+#include "BME680_Daemon.hpp"
+#include "BME680_Record.hpp"
+#include "BME680_Registers.hpp"
+#include "BME680_Timing.hpp"
+
+/* Time a result may be late before the measurement is given up, in us */
+static const uint32_t READ_TIMEOUT = 100000;
+/* Poll interval while waiting for a late result, in us */
+static const uint32_t RETRY_INTERVAL = 1000;
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                              MESSAGE                                              *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+uint16_t BME680_Message::encode(uint8_t *packet) const
+{
+	packet[0] = type;
+	packet[1] = sensor;
+	packet[2] = (uint8_t)tag;
+	packet[3] = (uint8_t)(tag >> 8);
+	memcpy(packet + HEADER_SIZE, payload, size);
+	return (uint16_t)(HEADER_SIZE + size);
+}
+
+bool BME680_Message::decode(const uint8_t *packet, uint16_t length)
+{
+	if (length < HEADER_SIZE || length > MAX_SIZE)
+		return false;
+	type = packet[0];
+	sensor = packet[1];
+	tag = (uint16_t)(packet[2] | (packet[3] << 8));
+	size = (uint16_t)(length - HEADER_SIZE);
+	memcpy(payload, packet + HEADER_SIZE, size);
+	return true;
+}
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                              DAEMON                                               *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+BME680_Daemon::Sensor::Sensor(BME680_Base &device)
+	: dev(device), cal(), comp(cal), meas(device), stats(0), mode(BME680_Mode::TPH), period(1000000), due(0), ready(0),
+	deadline(0), measuring(false), readers(0), subscribers(0), registers(0)
+{
+	memset(readTag, 0, sizeof(readTag));
+}
+
+BME680_Daemon::BME680_Daemon(BME680_Clock &c)
+	: cycles(0), coalesced(0), dropped(0), clock(c), broadcast(0), sensorCount(0), listener(-1)
+{
+	path[0] = 0;
+	for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+		clients[i].fd = -1;
+}
+
+BME680_Daemon::~BME680_Daemon()
+{
+	close();
+	for (uint8_t i = 0; i < sensorCount; i++)
+		delete sensors[i];
+}
+
+int BME680_Daemon::addSensor(BME680_Base &dev, uint32_t periodMs)
+{
+	if (sensorCount == MAX_SENSORS)
+		return -1;
+	Sensor *s = new Sensor(dev);
+	s->cal.read(dev);
+	s->period = periodMs * 1000;
+	s->due = clock.micros();
+	sensors[sensorCount] = s;
+	return sensorCount++;
+}
+
+void BME680_Daemon::setOversampling(uint8_t sensor, uint8_t osrs_t, uint8_t osrs_p, uint8_t osrs_h)
+{
+	if (sensor < sensorCount)
+		sensors[sensor]->meas.setOversampling(osrs_t, osrs_p, osrs_h);
+}
+
+void BME680_Daemon::setHeater(uint8_t sensor, uint16_t target, uint16_t waitMs)
+{
+	if (sensor >= sensorCount)
+		return;
+	Sensor &s = *sensors[sensor];
+	if (target == 0)
+	{
+		s.mode = BME680_Mode::TPH;
+		return;
+	}
+	/* Ambient temperature of the last measurement, room temperature before the first one */
+	int16_t ambient = s.comp.hasTemperature() ? (int16_t)(((s.comp.tFine() * 5 + 128) >> 8) / 100) : 25;
+	uint8_t gasWait = BME680_Timing::gasWaitCode(waitMs);
+	s.dev.setRes_heat_0(s.comp.heaterResistance(target, ambient));
+	s.dev.setGas_wait_0(gasWait);
+	s.meas.setGas(0, gasWait);
+	s.mode = BME680_Mode::TPHG;
+}
+
+void BME680_Daemon::setStats(uint8_t sensor, BME680_SampleSink *sink)
+{
+	if (sensor < sensorCount)
+		sensors[sensor]->stats = sink;
+}
+
+bool BME680_Daemon::listen(const char *socketPath)
+{
+	close();
+	struct sockaddr_un addr;
+	if (strlen(socketPath) >= sizeof(addr.sun_path))
+		return false;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, socketPath);
+
+	listener = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+	if (listener < 0)
+		return false;
+	unlink(socketPath);
+	if (bind(listener, (struct sockaddr *)&addr, sizeof(addr)) != 0 || ::listen(listener, MAX_CLIENTS) != 0)
+	{
+		::close(listener);
+		listener = -1;
+		return false;
+	}
+	strcpy(path, socketPath);
+	return true;
+}
+
+void BME680_Daemon::close()
+{
+	for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+		if (clients[i].fd >= 0)
+			drop(i);
+	if (listener >= 0)
+	{
+		::close(listener);
+		unlink(path);
+	}
+	listener = -1;
+	path[0] = 0;
+}
+
+void BME680_Daemon::accept()
+{
+	int fd = ::accept(listener, 0, 0);
+	if (fd < 0)
+		return;
+	for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+	{
+		if (clients[i].fd < 0)
+		{
+			Client &c = clients[i];
+			c.fd = fd;
+			for (uint8_t j = 0; j < MAX_SENSORS; j++)
+			{
+				c.subTag[j] = 0;
+				c.interval[j] = 0;
+				c.sent[j] = 0;
+			}
+			return;
+		}
+	}
+	::close(fd);
+}
+
+void BME680_Daemon::drop(uint8_t client)
+{
+	uint32_t bit = (uint32_t)1 << client;
+	for (uint8_t i = 0; i < sensorCount; i++)
+	{
+		sensors[i]->readers &= ~bit;
+		sensors[i]->subscribers &= ~bit;
+		sensors[i]->registers &= ~bit;
+	}
+	::close(clients[client].fd);
+	clients[client].fd = -1;
+}
+
+void BME680_Daemon::send(uint8_t client, const BME680_Message &msg)
+{
+	uint8_t packet[BME680_Message::MAX_SIZE];
+	uint16_t length = msg.encode(packet);
+	/* Never block on a slow client: a full socket buffer drops the message */
+	if (::send(clients[client].fd, packet, length, MSG_DONTWAIT | MSG_NOSIGNAL) < 0)
+	{
+		if (errno == EAGAIN || errno == EWOULDBLOCK)
+			dropped++;
+		else
+			drop(client);
+	}
+}
+
+void BME680_Daemon::error(uint8_t client, const BME680_Message &request, uint8_t code)
+{
+	BME680_Message msg;
+	msg.type = BME680_Message::ERROR;
+	msg.sensor = request.sensor;
+	msg.tag = request.tag;
+	msg.payload[0] = request.type;
+	msg.payload[1] = code;
+	msg.size = 2;
+	send(client, msg);
+}
+
+void BME680_Daemon::receive(uint8_t client)
+{
+	uint8_t packet[BME680_Message::MAX_SIZE];
+	ssize_t length = recv(clients[client].fd, packet, sizeof(packet), MSG_DONTWAIT);
+	if (length <= 0)
+	{
+		if (length == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+			drop(client);
+		return;
+	}
+	BME680_Message msg;
+	if (!msg.decode(packet, (uint16_t)length))
+	{
+		error(client, msg, BME680_Message::BAD_REQUEST);
+		return;
+	}
+	handle(client, msg);
+}
+
+void BME680_Daemon::handle(uint8_t client, const BME680_Message &msg)
+{
+	if (msg.sensor >= sensorCount)
+	{
+		error(client, msg, BME680_Message::NO_SENSOR);
+		return;
+	}
+	Sensor &s = *sensors[msg.sensor];
+	Client &c = clients[client];
+	uint32_t bit = (uint32_t)1 << client;
+
+	switch (msg.type)
+	{
+	case BME680_Message::READ:
+		/* Served by the running or the next measurement, together with everyone else */
+		if (s.measuring || s.readers)
+			coalesced++;
+		s.readers |= bit;
+		s.readTag[client] = msg.tag;
+		break;
+	case BME680_Message::SUBSCRIBE:
+	{
+		uint32_t interval = 0;
+		if (msg.size >= 4)
+			interval = msg.payload[0] | (msg.payload[1] << 8) | (msg.payload[2] << 16) | ((uint32_t)msg.payload[3] << 24);
+		if (s.subscribers)
+			coalesced++;
+		s.subscribers |= bit;
+		c.subTag[msg.sensor] = msg.tag;
+		c.interval[msg.sensor] = interval * 1000;
+		c.sent[msg.sensor] = 0;
+		break;
+	}
+	case BME680_Message::UNSUBSCRIBE:
+	{
+		s.subscribers &= ~bit;
+		BME680_Message ack = msg;
+		ack.type = BME680_Message::ACK;
+		ack.size = 0;
+		send(client, ack);
+		break;
+	}
+	case BME680_Message::REG_READ:
+	case BME680_Message::REG_WRITE:
+		if (s.registers & bit)
+			error(client, msg, BME680_Message::BUSY);
+		else if (s.measuring)
+		{
+			/* Executed once the running measurement is complete */
+			c.request = msg;
+			s.registers |= bit;
+		}
+		else
+			registers(client, msg);
+		break;
+	default:
+		error(client, msg, BME680_Message::BAD_REQUEST);
+	}
+}
+
+void BME680_Daemon::registers(uint8_t client, const BME680_Message &msg)
+{
+	Sensor &s = *sensors[msg.sensor];
+	BME680_Message response;
+	response.sensor = msg.sensor;
+	response.tag = msg.tag;
+
+	if (msg.type == BME680_Message::REG_READ)
+	{
+		uint8_t count = msg.size >= 2 ? msg.payload[1] : 0;
+		if (count == 0 || count >= BME680_Message::MAX_PAYLOAD || msg.payload[0] + count > 256)
+		{
+			error(client, msg, BME680_Message::BAD_REQUEST);
+			return;
+		}
+		response.type = BME680_Message::REGISTERS;
+		response.payload[0] = msg.payload[0];
+		s.dev.readBurst(msg.payload[0], response.payload + 1, count);
+		response.size = (uint16_t)(count + 1);
+		send(client, response);
+		return;
+	}
+
+	if (msg.size < 2)
+	{
+		error(client, msg, BME680_Message::BAD_REQUEST);
+		return;
+	}
+	uint16_t count = (uint16_t)(msg.size - 1);
+	for (uint16_t i = 0; i < count; i++)
+	{
+		const BME680_RegisterInfo *reg = BME680_findRegister((uint16_t)(msg.payload[0] + i));
+		if (!reg || !(reg->access & BME680_Access::WRITE))
+		{
+			error(client, msg, BME680_Message::NOT_WRITABLE);
+			return;
+		}
+	}
+	s.dev.writeBurst(msg.payload[0], msg.payload + 1, count);
+	/* The configuration is no longer what the measurement wrote */
+	s.meas.invalidate();
+	response.type = BME680_Message::ACK;
+	send(client, response);
+}
+
+void BME680_Daemon::complete(uint8_t sensor, uint64_t now)
+{
+	Sensor &s = *sensors[sensor];
+	BME680_RawSample raw;
+	uint8_t result = s.meas.fetch(raw);
+	if (result != BME680_ReadStatus::OK)
+	{
+		if (result != BME680_ReadStatus::REPEATED && now < s.deadline)
+		{
+			s.ready = now + RETRY_INTERVAL;
+			return;
+		}
+		/* No result: the one-shot readers get an error instead of waiting for a sample that may never come */
+		s.measuring = false;
+		BME680_Message request;
+		request.type = BME680_Message::READ;
+		request.sensor = sensor;
+		for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+			if (s.readers & ((uint32_t)1 << i))
+			{
+				request.tag = s.readTag[i];
+				error(i, request, BME680_Message::NO_SENSOR);
+			}
+		s.readers = 0;
+		pending(s);
+		return;
+	}
+	s.measuring = false;
+	cycles++;
+
+	BME680_Sample sample;
+	sample.timestamp = (uint32_t)(now / 1000);
+	s.comp.compensate(raw, sample);
+	if (s.stats)
+		s.stats->add(sample);
+
+	BME680_Message msg;
+	msg.type = BME680_Message::SAMPLE;
+	msg.sensor = sensor;
+	msg.size = sizeof(bme680_record);
+	bme680_record record;
+	BME680_fillRecord(record, sensor, now, raw, sample);
+	memcpy(msg.payload, &record, sizeof(record));
+	if (broadcast)
+		broadcast->publish(sensor, record);
+
+	for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+	{
+		uint32_t bit = (uint32_t)1 << i;
+		if (s.readers & bit)
+		{
+			msg.tag = s.readTag[i];
+			send(i, msg);
+		}
+		else if ((s.subscribers & bit) && now - clients[i].sent[sensor] >= clients[i].interval[sensor])
+		{
+			msg.tag = clients[i].subTag[sensor];
+			clients[i].sent[sensor] = now;
+			send(i, msg);
+		}
+	}
+	s.readers = 0;
+	pending(s);
+}
+
+void BME680_Daemon::pending(Sensor &s)
+{
+	/* Register requests that waited for the measurement */
+	for (uint8_t i = 0; i < MAX_CLIENTS && s.registers; i++)
+	{
+		uint32_t bit = (uint32_t)1 << i;
+		if (s.registers & bit)
+		{
+			s.registers &= ~bit;
+			registers(i, clients[i].request);
+		}
+	}
+}
+
+uint64_t BME680_Daemon::schedule(uint64_t now)
+{
+	uint64_t next = (uint64_t)-1;
+	for (uint8_t i = 0; i < sensorCount; i++)
+	{
+		Sensor &s = *sensors[i];
+		if (s.measuring && now >= s.ready)
+			complete(i, now);
+		if (!s.measuring)
+		{
+			bool periodic = s.subscribers && now >= s.due;
+			if (periodic || s.readers)
+			{
+				s.ready = now + s.meas.start(s.mode);
+				s.deadline = s.ready + READ_TIMEOUT;
+				s.measuring = true;
+				if (periodic)
+					s.due = s.due + s.period > now ? s.due + s.period : now + s.period;
+			}
+		}
+		if (s.measuring && s.ready < next)
+			next = s.ready;
+		if (!s.measuring && s.subscribers && s.due < next)
+			next = s.due;
+	}
+	return next;
+}
+
+void BME680_Daemon::poll(uint32_t timeoutUs)
+{
+	uint64_t now = clock.micros();
+	uint64_t next = schedule(now);
+	uint64_t wait = next > now ? next - now : 0;
+	if (wait > timeoutUs)
+		wait = timeoutUs;
+
+	struct pollfd fds[MAX_CLIENTS + 1];
+	uint8_t index[MAX_CLIENTS];
+	nfds_t n = 0;
+	if (listener >= 0)
+	{
+		fds[n].fd = listener;
+		fds[n].events = POLLIN;
+		n++;
+	}
+	for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+	{
+		if (clients[i].fd >= 0)
+		{
+			index[n - (listener >= 0)] = i;
+			fds[n].fd = clients[i].fd;
+			fds[n].events = POLLIN;
+			n++;
+		}
+	}
+
+	int ready = ::poll(fds, n, (int)((wait + 999) / 1000));
+	if (ready > 0)
+	{
+		nfds_t first = 0;
+		if (listener >= 0)
+		{
+			if (fds[0].revents & POLLIN)
+				accept();
+			first = 1;
+		}
+		for (nfds_t k = first; k < n; k++)
+			if (fds[k].revents & (POLLIN | POLLHUP | POLLERR))
+				receive(index[k - first]);
+	}
+	else if (ready == 0)
+	{
+		/* A virtual clock does not advance while poll waits */
+		uint64_t elapsed = clock.micros() - now;
+		if (elapsed < wait)
+			clock.sleep((uint32_t)(wait - elapsed));
+	}
+	schedule(clock.micros());
+}
+
+void BME680_Daemon::run(uint32_t durationUs)
+{
+	uint64_t end = clock.micros() + durationUs;
+	for (uint64_t now = clock.micros(); now < end; now = clock.micros())
+		poll((uint32_t)(end - now));
+}
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                              CLIENT                                               *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+BME680_DaemonClient::BME680_DaemonClient()
+	: sock(-1)
+{
+}
+
+BME680_DaemonClient::~BME680_DaemonClient()
+{
+	close();
+}
+
+bool BME680_DaemonClient::connect(const char *path)
+{
+	close();
+	struct sockaddr_un addr;
+	if (strlen(path) >= sizeof(addr.sun_path))
+		return false;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+	sock = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+	if (sock < 0)
+		return false;
+	if (::connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+void BME680_DaemonClient::close()
+{
+	if (sock >= 0)
+		::close(sock);
+	sock = -1;
+}
+
+bool BME680_DaemonClient::send(const BME680_Message &msg)
+{
+	uint8_t packet[BME680_Message::MAX_SIZE];
+	uint16_t length = msg.encode(packet);
+	return ::send(sock, packet, length, MSG_NOSIGNAL) == length;
+}
+
+bool BME680_DaemonClient::receive(BME680_Message &msg, int timeoutMs)
+{
+	struct pollfd fd;
+	fd.fd = sock;
+	fd.events = POLLIN;
+	if (::poll(&fd, 1, timeoutMs) <= 0)
+		return false;
+	uint8_t packet[BME680_Message::MAX_SIZE];
+	ssize_t length = recv(sock, packet, sizeof(packet), 0);
+	return length > 0 && msg.decode(packet, (uint16_t)length);
+}
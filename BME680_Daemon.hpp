@@ -0,0 +1,186 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Daemon.hpp
+ */
+
+#ifndef BME680_DAEMON_HPP
+#define BME680_DAEMON_HPP
+
+#include <cinttypes>
+#include "BME680_Core.hpp"
+#include "BME680_Calibration.hpp"
+#include "BME680_Clock.hpp"
+#include "BME680_Compensation.hpp"
+#include "BME680_Measurement.hpp"
+#include "BME680_Shm.hpp"
+#include "BME680_Stats.hpp"
+#include "bme680_record.h"
+
+/*
+ * Protocol between BME680_Daemon and its clients on a Unix domain SOCK_SEQPACKET socket.
+ * Each packet is one message: a 4 byte header followed by the payload, whose size is
+ * the packet size minus the header. Multi-byte values are little endian.
+ * The tag of a request is copied into its response(s), so a client can match them.
+ */
+struct BME680_Message
+{
+	/* Requests */
+	static const uint8_t READ = 0x01; // one-shot sample
+	static const uint8_t SUBSCRIBE = 0x02; // payload: uint32 minimum interval in ms (0: every sample)
+	static const uint8_t UNSUBSCRIBE = 0x03;
+	static const uint8_t REG_READ = 0x04; // payload: uint8 address, uint8 count
+	static const uint8_t REG_WRITE = 0x05; // payload: uint8 address, data bytes
+	/* Responses */
+	static const uint8_t SAMPLE = 0x81; // payload: bme680_record
+	static const uint8_t REGISTERS = 0x84; // payload: uint8 address, data bytes
+	static const uint8_t ACK = 0x85;
+	static const uint8_t ERROR = 0xFF; // payload: uint8 request type, uint8 error code
+
+	/* Error codes */
+	static const uint8_t NO_SENSOR = 1; // unknown sensor, or READ: the measurement gave no result
+	static const uint8_t BAD_REQUEST = 2;
+	static const uint8_t BUSY = 3; // a register request of this client is still pending
+	static const uint8_t NOT_WRITABLE = 4;
+
+	static const uint16_t HEADER_SIZE = 4;
+	static const uint16_t MAX_PAYLOAD = 72;
+	static const uint16_t MAX_SIZE = HEADER_SIZE + MAX_PAYLOAD;
+
+	uint8_t type;
+	uint8_t sensor;
+	uint16_t tag;
+	uint8_t payload[MAX_PAYLOAD];
+	uint16_t size; // payload bytes
+
+	BME680_Message() : type(0), sensor(0), tag(0), size(0) {}
+
+	/* Wire format, returns the packet size */
+	uint16_t encode(uint8_t *packet) const;
+	/* False if the packet is shorter than the header or too long */
+	bool decode(const uint8_t *packet, uint16_t length);
+};
+
+/*
+ * Daemon owning a set of BME680 devices. It runs the measurements and serves any number
+ * of clients (up to MAX_CLIENTS), so applications never access the bus themselves.
+ * All clients waiting for a sensor are served by the same bus cycle: one-shot reads that
+ * arrive while a measurement is running get its result, and a subscriber receives the
+ * samples of the periodic schedule no more often than its requested interval.
+ * Register requests are executed between measurements, never while one is running.
+ * Single threaded: call run() or poll() from one thread.
+ */
+class BME680_Daemon
+{
+public:
+	static const uint8_t MAX_SENSORS = 8;
+	static const uint8_t MAX_CLIENTS = 16;
+
+	BME680_Daemon(BME680_Clock &clock);
+	~BME680_Daemon();
+
+	/* Add a device and read its calibration, returns the sensor index or -1 */
+	int addSensor(BME680_Base &dev, uint32_t periodMs);
+	void setOversampling(uint8_t sensor, uint8_t osrs_t, uint8_t osrs_p, uint8_t osrs_h);
+	/* Heater target in degree Celsius and wait time in ms, target 0 measures without gas */
+	void setHeater(uint8_t sensor, uint16_t target, uint16_t waitMs);
+	/* Also publish every sample to shared memory (sensor index = table index) */
+	void setBroadcast(BME680_ShmBroadcast *shm) { broadcast = shm; }
+	/* Also add every compensated sample of a sensor to an aggregator (0: none) */
+	void setStats(uint8_t sensor, BME680_SampleSink *sink);
+
+	/* Create the listening socket, an existing socket file at path is replaced */
+	bool listen(const char *path);
+	void close();
+
+	/* One iteration: wait for requests or the next measurement event, at most timeoutUs */
+	void poll(uint32_t timeoutUs);
+	/* Serve for durationUs */
+	void run(uint32_t durationUs);
+
+	/* Counters */
+	uint32_t cycles; // measurements performed
+	uint32_t coalesced; // requests served by a measurement that was already scheduled
+	uint32_t dropped; // messages not sent because a client's socket buffer was full
+
+private:
+	BME680_Daemon(const BME680_Daemon &);
+	BME680_Daemon &operator=(const BME680_Daemon &);
+
+	struct Sensor
+	{
+		Sensor(BME680_Base &dev);
+
+		BME680_Base &dev;
+		BME680_Calibration cal;
+		BME680_Compensation comp;
+		BME680_Measurement meas;
+		BME680_SampleSink *stats;
+		uint8_t mode;
+		uint32_t period; // us
+		uint64_t due; // next periodic measurement
+		uint64_t ready; // end of the running measurement, or the next retry
+		uint64_t deadline; // the running measurement is given up after this
+		bool measuring;
+		uint32_t readers; // clients waiting for a one-shot sample, bit per client
+		uint32_t subscribers; // bit per client
+		uint32_t registers; // clients with a pending register request
+		uint16_t readTag[MAX_CLIENTS];
+	};
+
+	struct Client
+	{
+		int fd; // -1 if unused
+		uint16_t subTag[MAX_SENSORS];
+		uint32_t interval[MAX_SENSORS]; // us
+		uint64_t sent[MAX_SENSORS]; // time of the last sample sent
+		BME680_Message request; // pending register request
+	};
+
+	void accept();
+	void receive(uint8_t client);
+	void handle(uint8_t client, const BME680_Message &msg);
+	void registers(uint8_t client, const BME680_Message &msg);
+	void send(uint8_t client, const BME680_Message &msg);
+	void error(uint8_t client, const BME680_Message &msg, uint8_t code);
+	void drop(uint8_t client);
+	void complete(uint8_t sensor, uint64_t now);
+	void pending(Sensor &s);
+	uint64_t schedule(uint64_t now);
+
+	BME680_Clock &clock;
+	BME680_ShmBroadcast *broadcast;
+	Sensor *sensors[MAX_SENSORS];
+	uint8_t sensorCount;
+	Client clients[MAX_CLIENTS];
+	int listener;
+	char path[108];
+};
+
+/* Blocking client of BME680_Daemon */
+class BME680_DaemonClient
+{
+public:
+	BME680_DaemonClient();
+	~BME680_DaemonClient();
+
+	bool connect(const char *path);
+	void close();
+
+	bool send(const BME680_Message &msg);
+	/* Wait up to timeoutMs (negative: forever) for the next message */
+	bool receive(BME680_Message &msg, int timeoutMs);
+
+	int fd() const { return sock; }
+
+private:
+	BME680_DaemonClient(const BME680_DaemonClient &);
+	BME680_DaemonClient &operator=(const BME680_DaemonClient &);
+
+	int sock;
+};
+
+#endif
@@ -0,0 +1,438 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_DataRegisters.hpp
+ */
+
+#ifndef BME680_DATAREGISTERS_HPP
+#define BME680_DATAREGISTERS_HPP
+
+#include <cinttypes>
+
+/*
+ * Data registers of BME680_Base: measurement results: pressure, temperature, humidity and gas resistance.
+ * Include this header alone where only the constants are needed:
+ * BME680_DataRegisters::gas_r_lsb::__address is BME680_Base::gas_r_lsb::__address.
+ */
+struct BME680_DataRegisters
+{
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                          REG gas_r_lsb                                           *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG gas_r_lsb:
+	 * 5.3.4.5 Gas resistance range
+	 * 5.3.4.4 Gas resistance data
+	 * 5.3.5.5 Gas valid status
+	 * 5.3.5.6 Heater Stability Status
+	 */
+	struct gas_r_lsb
+	{
+		static const uint16_t __address = 43;
+		
+		/* Bits gas_r: */
+		/* Contains the LSB part gas resistance [1:0] of the raw gas resistance.  */
+		struct gas_r
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b11000000; // [6,7]
+		};
+		/* Bits gas_valid_r: */
+		/*
+		 * Gas valid bit
+		 * In each TPHG sequence contains a gas measurement slot, either a real one which
+		 * result is used or a dummy one to keep a constant sampling rate and predictable
+		 * device timing. A real gas conversion (i.e., not a dummy one) is indicated by the
+		 * gas_valid_r status register.
+		 */
+		struct gas_valid_r
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b00100000; // [5]
+		};
+		/* Bits heat_stab_r: */
+		/* Heater stability bit */
+		struct heat_stab_r
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b00010000; // [4]
+		};
+		/* Bits gas_range_r: */
+		/* Contains ADC range of measured gas resistance */
+		struct gas_range_r
+		{
+			static const uint8_t dflt = 0b0000; // 4'b0
+			static const uint8_t mask = 0b00001111; // [0,1,2,3]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                          REG gas_r_msb                                           *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG gas_r_msb:
+	 * 5.3.4.4 Gas resistance data
+	 */
+	struct gas_r_msb
+	{
+		static const uint16_t __address = 42;
+		
+		/* Bits gas_r: */
+		/* Contains the MSB part gas resistance [9:2] of the raw gas resistance.  */
+		struct gas_r
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                           REG hum_lsb                                            *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG hum_lsb:
+	 * 5.3.4.3 Humidity data
+	 */
+	struct hum_lsb
+	{
+		static const uint16_t __address = 38;
+		
+		/* Bits hum_lsb: */
+		/* Contains the LSB part [7:0] of the raw humidity measurement output data.  */
+		struct hum_lsb_
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                           REG hum_msb                                            *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG hum_msb:
+	 * 5.3.4.3 Humidity data
+	 */
+	struct hum_msb
+	{
+		static const uint16_t __address = 37;
+		
+		/* Bits hum_msb: */
+		/* Contains the MSB part [15:8] of the raw humidity measurement output data.  */
+		struct hum_msb_
+		{
+			static const uint8_t dflt = 0b10000000; // 8'b10000000
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                          REG temp_xlsb                                           *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG temp_xlsb:
+	 * 5.3.4.2 Temp data
+	 */
+	struct temp_xlsb
+	{
+		static const uint16_t __address = 36;
+		
+		/* Bits temp_xlsb: */
+		/*
+		 * Contains the XLSB part [3:0] of the raw temperature measurement output data.
+		 * Contents depend on temperature resolution controlled by oversampling setting.
+		 */
+		struct temp_xlsb_
+		{
+			static const uint8_t dflt = 0b0000; // 4'b0
+			static const uint8_t mask = 0b11110000; // [4,5,6,7]
+		};
+		/* Bits unused_0: */
+		struct unused_0
+		{
+			static const uint8_t dflt = 0b0000; // 4'b0
+			static const uint8_t mask = 0b00001111; // [0,1,2,3]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                           REG temp_lsb                                            *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG temp_lsb:
+	 * 5.3.4.2 Temp data
+	 */
+	struct temp_lsb
+	{
+		static const uint16_t __address = 35;
+		
+		/* Bits temp_lsb: */
+		/* Contains the LSB part [11:4] of the raw temperature measurement output data.  */
+		struct temp_lsb_
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                           REG temp_msb                                            *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG temp_msb:
+	 * 5.3.4.2 Temp data
+	 */
+	struct temp_msb
+	{
+		static const uint16_t __address = 34;
+		
+		/* Bits temp_msb: */
+		/* Contains the MSB part [19:12] of the raw temperature measurement output data.  */
+		struct temp_msb_
+		{
+			static const uint8_t dflt = 0b10000000; // 8'b10000000
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG press_xlsb                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG press_xlsb:
+	 * 5.3.4.1 Pressure data
+	 */
+	struct press_xlsb
+	{
+		static const uint16_t __address = 33;
+		
+		/* Bits press_xlsb: */
+		/*
+		 * Contains the XLSB part [3:0] of the raw pressure measurement output data.
+		 * Contents depend on pressure resolution controlled by oversampling setting.
+		 */
+		struct press_xlsb_
+		{
+			static const uint8_t dflt = 0b0000; // 4'b0
+			static const uint8_t mask = 0b11110000; // [4,5,6,7]
+		};
+		/* Bits unused_0: */
+		struct unused_0
+		{
+			static const uint8_t dflt = 0b0000; // 4'b0
+			static const uint8_t mask = 0b00001111; // [0,1,2,3]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                          REG press_lsb                                           *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG press_lsb:
+	 * 5.3.4.1 Pressure data
+	 */
+	struct press_lsb
+	{
+		static const uint16_t __address = 32;
+		
+		/* Bits press_lsb: */
+		/* Contains the LSB part [11:4] of the raw pressure measurement output data  */
+		struct press_lsb_
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                          REG press_msb                                           *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG press_msb:
+	 * 5.3.4.1 Pressure data
+	 */
+	struct press_msb
+	{
+		static const uint16_t __address = 31;
+		
+		/* Bits press_msb: */
+		/* Contains the MSB part [19:12] of the raw pressure measurement output data.  */
+		struct press_msb_
+		{
+			static const uint8_t dflt = 0b10000000; // 8'b10000000
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+};
+
+/* Set/get accessors of the data registers, D implements read8 and write */
+template <class D>
+class BME680_DataAccess : public BME680_DataRegisters
+{
+public:
+	/* Set register gas_r_lsb */
+	void setgas_r_lsb(uint8_t value)
+	{
+		static_cast<D *>(this)->write(gas_r_lsb::__address, value, 8);
+	}
+	
+	/* Get register gas_r_lsb */
+	uint8_t getgas_r_lsb()
+	{
+		return static_cast<D *>(this)->read8(gas_r_lsb::__address, 8);
+	}
+	
+	/* Set register gas_r_msb */
+	void setgas_r_msb(uint8_t value)
+	{
+		static_cast<D *>(this)->write(gas_r_msb::__address, value, 8);
+	}
+	
+	/* Get register gas_r_msb */
+	uint8_t getgas_r_msb()
+	{
+		return static_cast<D *>(this)->read8(gas_r_msb::__address, 8);
+	}
+	
+	/* Set register hum_lsb */
+	void sethum_lsb(uint8_t value)
+	{
+		static_cast<D *>(this)->write(hum_lsb::__address, value, 8);
+	}
+	
+	/* Get register hum_lsb */
+	uint8_t gethum_lsb()
+	{
+		return static_cast<D *>(this)->read8(hum_lsb::__address, 8);
+	}
+	
+	/* Set register hum_msb */
+	void sethum_msb(uint8_t value)
+	{
+		static_cast<D *>(this)->write(hum_msb::__address, value, 8);
+	}
+	
+	/* Get register hum_msb */
+	uint8_t gethum_msb()
+	{
+		return static_cast<D *>(this)->read8(hum_msb::__address, 8);
+	}
+	
+	/* Set register temp_xlsb */
+	void settemp_xlsb(uint8_t value)
+	{
+		static_cast<D *>(this)->write(temp_xlsb::__address, value, 8);
+	}
+	
+	/* Get register temp_xlsb */
+	uint8_t gettemp_xlsb()
+	{
+		return static_cast<D *>(this)->read8(temp_xlsb::__address, 8);
+	}
+	
+	/* Set register temp_lsb */
+	void settemp_lsb(uint8_t value)
+	{
+		static_cast<D *>(this)->write(temp_lsb::__address, value, 8);
+	}
+	
+	/* Get register temp_lsb */
+	uint8_t gettemp_lsb()
+	{
+		return static_cast<D *>(this)->read8(temp_lsb::__address, 8);
+	}
+	
+	/* Set register temp_msb */
+	void settemp_msb(uint8_t value)
+	{
+		static_cast<D *>(this)->write(temp_msb::__address, value, 8);
+	}
+	
+	/* Get register temp_msb */
+	uint8_t gettemp_msb()
+	{
+		return static_cast<D *>(this)->read8(temp_msb::__address, 8);
+	}
+	
+	/* Set register press_xlsb */
+	void setpress_xlsb(uint8_t value)
+	{
+		static_cast<D *>(this)->write(press_xlsb::__address, value, 8);
+	}
+	
+	/* Get register press_xlsb */
+	uint8_t getpress_xlsb()
+	{
+		return static_cast<D *>(this)->read8(press_xlsb::__address, 8);
+	}
+	
+	/* Set register press_lsb */
+	void setpress_lsb(uint8_t value)
+	{
+		static_cast<D *>(this)->write(press_lsb::__address, value, 8);
+	}
+	
+	/* Get register press_lsb */
+	uint8_t getpress_lsb()
+	{
+		return static_cast<D *>(this)->read8(press_lsb::__address, 8);
+	}
+	
+	/* Set register press_msb */
+	void setpress_msb(uint8_t value)
+	{
+		static_cast<D *>(this)->write(press_msb::__address, value, 8);
+	}
+	
+	/* Get register press_msb */
+	uint8_t getpress_msb()
+	{
+		return static_cast<D *>(this)->read8(press_msb::__address, 8);
+	}
+};
+
+#endif
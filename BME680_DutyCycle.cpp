@@ -0,0 +1,141 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_DutyCycle.cpp
+ */
+
+#include "BME680.hpp"
+#include "BME680_DutyCycle.hpp"
+#include "BME680_Timing.hpp"
+
+BME680_PowerModel::BME680_PowerModel()
+	: voltage(1.8), sleepCurrent(0.15e-6), temperatureCurrent(350e-6), pressureCurrent(714e-6),
+	  humidityCurrent(340e-6), heaterCurrent(12e-3)
+{
+}
+
+double BME680_PowerModel::cycleEnergy(uint8_t osrs_t, uint8_t osrs_p, uint8_t osrs_h, uint32_t heaterUs) const
+{
+	const double cycle = BME680_Timing::CYCLE_US * 1e-6;
+	double charge = BME680_Timing::factor(osrs_t) * cycle * temperatureCurrent
+		+ BME680_Timing::factor(osrs_p) * cycle * pressureCurrent
+		+ BME680_Timing::factor(osrs_h) * cycle * humidityCurrent
+		+ (BME680_Timing::SWITCH_US + BME680_Timing::WAKEUP_US) * 1e-6 * temperatureCurrent
+		+ heaterUs * 1e-6 * heaterCurrent;
+	return charge * voltage;
+}
+
+BME680_DutyCycleScheduler::BME680_DutyCycleScheduler(const BME680_PowerModel &model)
+	: power(model), tphPeriod(0), gasPeriod(0), step(0), wait(0), resHeat(0),
+	  tphDue(0), gasDue(0), startTime(0), lastGas(-1), cycleEnergy(0.0), activeMs(0.0)
+{
+	osrs[0] = osrs[1] = osrs[2] = BME680_Base::Ctrl_meas::osrs_t::X1;
+}
+
+void BME680_DutyCycleScheduler::setTPH(uint32_t periodMs, uint8_t osrs_t, uint8_t osrs_p, uint8_t osrs_h)
+{
+	tphPeriod = periodMs;
+	osrs[0] = osrs_t;
+	osrs[1] = osrs_p;
+	osrs[2] = osrs_h;
+}
+
+void BME680_DutyCycleScheduler::setGas(uint32_t periodMs, uint8_t heaterStep, uint16_t waitMs, uint8_t resHeatValue)
+{
+	gasPeriod = periodMs;
+	step = heaterStep < 10 ? heaterStep : 9;
+	wait = waitMs;
+	resHeat = resHeatValue;
+}
+
+uint32_t BME680_DutyCycleScheduler::heaterUs() const
+{
+	return BME680_Timing::gasWait(BME680_Timing::gasWaitCode(wait)) * 1000 + BME680_Timing::GAS_US;
+}
+
+void BME680_DutyCycleScheduler::configure(BME680_Base &dev, uint32_t now)
+{
+	typedef BME680_Base::Ctrl_hum H;
+	dev.setCtrl_hum((uint8_t)((dev.getCtrl_hum() & ~H::osrs_h::mask) | (osrs[2] & H::osrs_h::mask)));
+	if (gasPeriod)
+	{
+		dev.write(BME680_Base::Gas_wait_0::__address + step, BME680_Timing::gasWaitCode(wait), 8);
+		dev.write(BME680_Base::Res_heat_0::__address + step, resHeat, 8);
+	}
+	tphDue = gasDue = startTime = now;
+	lastGas = -1;
+	cycleEnergy = 0.0;
+	activeMs = 0.0;
+}
+
+uint32_t BME680_DutyCycleScheduler::next() const
+{
+	if (!tphPeriod)
+		return gasDue;
+	if (!gasPeriod)
+		return tphDue;
+	return (int32_t)(gasDue - tphDue) < 0 ? gasDue : tphDue;
+}
+
+uint32_t BME680_DutyCycleScheduler::run(BME680_Base &dev, uint32_t now)
+{
+	typedef BME680_Base::Ctrl_meas M;
+	typedef BME680_Base::Ctrl_gas_0 G0;
+	typedef BME680_Base::Ctrl_gas_1 G1;
+
+	bool gas = gasPeriod && due(now, gasDue);
+	bool tph = tphPeriod && due(now, tphDue);
+	if (!gas && !tph)
+		return 0;
+
+	/* Heater registers only change when a gas cycle follows a TPH only cycle or vice versa */
+	if (lastGas != (gas ? 1 : 0))
+	{
+		dev.setCtrl_gas_0(gas ? (uint8_t)(G0::heat_off::HEAT_ON << 3) : (uint8_t)(G0::heat_off::HEAT_OFF << 3));
+		dev.setCtrl_gas_1(gas ? (uint8_t)(G1::run_gas::mask | (step & G1::nb_conv::mask)) : 0);
+		lastGas = gas ? 1 : 0;
+	}
+	dev.setCtrl_meas((uint8_t)(((osrs[0] << 5) & M::osrs_t::mask) | ((osrs[1] << 2) & M::osrs_p::mask) | M::mode::FORCED));
+
+	/* Skip cycles that were missed instead of bursting to catch up */
+	if (tph)
+		do tphDue += tphPeriod; while (due(now, tphDue));
+	else if (tphPeriod)
+		tphDue = now + tphPeriod; // a gas cycle measures T/P/H as well
+	if (gas)
+		do gasDue += gasPeriod; while (due(now, gasDue));
+
+	uint32_t heater = gas ? heaterUs() : 0;
+	uint32_t duration = BME680_Timing::tphg(osrs[0], osrs[1], osrs[2], gas) + (gas ? heater - BME680_Timing::GAS_US : 0);
+	cycleEnergy += power.cycleEnergy(osrs[0], osrs[1], osrs[2], heater);
+	activeMs += duration / 1000.0;
+	return duration;
+}
+
+BME680_DutyCycleScheduler::Report BME680_DutyCycleScheduler::report() const
+{
+	Report r;
+	r.tphEnergy = power.cycleEnergy(osrs[0], osrs[1], osrs[2], 0);
+	r.gasEnergy = power.cycleEnergy(osrs[0], osrs[1], osrs[2], heaterUs());
+	r.gasPerHour = gasPeriod ? 3600000.0 / gasPeriod : 0.0;
+	r.cyclesPerHour = tphPeriod ? 3600000.0 / tphPeriod : r.gasPerHour;
+	if (r.gasPerHour > r.cyclesPerHour)
+		r.cyclesPerHour = r.gasPerHour;
+
+	double active = (r.cyclesPerHour - r.gasPerHour) * BME680_Timing::tphg(osrs[0], osrs[1], osrs[2], false) * 1e-6
+		+ r.gasPerHour * (BME680_Timing::tphg(osrs[0], osrs[1], osrs[2], true) + heaterUs() - BME680_Timing::GAS_US) * 1e-6;
+	double energy = (r.cyclesPerHour - r.gasPerHour) * r.tphEnergy + r.gasPerHour * r.gasEnergy
+		+ (active < 3600.0 ? 3600.0 - active : 0.0) * power.sleepPower();
+	r.averagePower = energy / 3600.0;
+	r.averageCurrent = r.averagePower / power.voltage;
+	return r;
+}
+
+double BME680_DutyCycleScheduler::consumed(uint32_t now) const
+{
+	double sleepMs = (uint32_t)(now - startTime) - activeMs;
+	return cycleEnergy + (sleepMs > 0.0 ? sleepMs / 1000.0 : 0.0) * power.sleepPower();
+}
@@ -0,0 +1,105 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_DutyCycle.hpp
+ */
+
+#ifndef BME680_DUTYCYCLE_HPP
+#define BME680_DUTYCYCLE_HPP
+
+#include <cinttypes>
+#include "BME680_Core.hpp"
+
+/*
+ * Energy model of the sensor. Currents default to the typical datasheet values,
+ * switching and wake up time are counted at the temperature conversion current.
+ */
+struct BME680_PowerModel
+{
+	double voltage; // V
+	double sleepCurrent; // A
+	double temperatureCurrent; // A, during temperature conversion
+	double pressureCurrent; // A, during pressure conversion
+	double humidityCurrent; // A, during humidity conversion
+	double heaterCurrent; // A, heater on (gas wait and gas conversion)
+
+	BME680_PowerModel();
+
+	/* Energy in J of one forced mode cycle, heaterUs = 0 for a cycle without gas */
+	double cycleEnergy(uint8_t osrs_t, uint8_t osrs_p, uint8_t osrs_h, uint32_t heaterUs) const;
+	/* Power in W while sleeping */
+	double sleepPower() const { return voltage * sleepCurrent; }
+};
+
+/*
+ * Forced mode scheduler for battery nodes. Temperature, pressure and humidity are
+ * measured every tphPeriod, gas every gasPeriod (e.g. 3 s and 5 min). The heater is
+ * switched on (Ctrl_gas_0::heat_off = 0, Ctrl_gas_1::run_gas = 1) only for cycles
+ * in which gas is due; those cycles also deliver T/P/H. All times are in ms on the
+ * caller's clock, which may be a virtual one (e.g. BME680_Simulator).
+ */
+class BME680_DutyCycleScheduler
+{
+public:
+	/* Steady state energy budget of the current plan */
+	struct Report
+	{
+		double tphEnergy; // J per T/P/H sample
+		double gasEnergy; // J per T/P/H/gas sample
+		double cyclesPerHour; // all forced mode cycles
+		double gasPerHour; // cycles with gas
+		double averagePower; // W, including sleep
+		double averageCurrent; // A
+
+		/* Battery life in hours for a capacity in mAh (ignoring self discharge) */
+		double hours(double mAh) const { return averageCurrent > 0.0 ? mAh / 1000.0 / averageCurrent : 0.0; }
+	};
+
+	BME680_DutyCycleScheduler(const BME680_PowerModel &model = BME680_PowerModel());
+
+	/* T/P/H period in ms (0 = only with gas) and osrs_x codes */
+	void setTPH(uint32_t periodMs, uint8_t osrs_t, uint8_t osrs_p, uint8_t osrs_h);
+	/* Gas period in ms (0 = no gas), heater step (nb_conv), heater wait and Res_heat_x value */
+	void setGas(uint32_t periodMs, uint8_t step, uint16_t waitMs, uint8_t resHeat);
+
+	/* Write Ctrl_hum, Gas_wait_x and Res_heat_x of the heater step, first cycles start at now */
+	void configure(BME680_Base &dev, uint32_t now);
+
+	/* Time of the next due cycle */
+	uint32_t next() const;
+	/*
+	 * Start the cycle due at now, if any: switch the heater as needed and write
+	 * Ctrl_meas in FORCED mode. Returns the conversion time in us, 0 if nothing is due.
+	 */
+	uint32_t run(BME680_Base &dev, uint32_t now);
+	/* The last started cycle included a gas conversion */
+	bool gas() const { return lastGas == 1; }
+
+	Report report() const;
+	/* Energy in J spent by the started cycles plus sleep since configure() */
+	double consumed(uint32_t now) const;
+
+private:
+	static bool due(uint32_t now, uint32_t at) { return (int32_t)(now - at) >= 0; }
+	uint32_t heaterUs() const;
+
+	BME680_PowerModel power;
+	uint32_t tphPeriod;
+	uint32_t gasPeriod;
+	uint8_t osrs[3];
+	uint8_t step;
+	uint16_t wait;
+	uint8_t resHeat;
+
+	uint32_t tphDue;
+	uint32_t gasDue;
+	uint32_t startTime;
+	int8_t lastGas; // heater state on the device: 1 on, 0 off, -1 unknown
+	double cycleEnergy; // J of started cycles
+	double activeMs; // time spent converting
+};
+
+#endif
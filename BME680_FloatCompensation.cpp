@@ -0,0 +1,253 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_FloatCompensation.cpp
+ */
+
+#include <cmath>
+#include "BME680.hpp"
+#include "BME680_FloatCompensation.hpp"
+
+/* Gas range correction factors in percent */
+static const float gasK1[16] = {0, 0, 0, 0, 0, -1.0f, 0, -0.8f, 0, 0, -0.2f, -0.5f, 0, -1.0f, 0, 0};
+static const float gasK2[16] = {0, 0, 0, 0, 0.1f, 0.7f, 0, -0.8f, -0.1f, 0, 0, 0, 0, 0, 0, 0};
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                        DOUBLE REFERENCE                                           *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+uint8_t BME680_compensateDouble(const BME680_Calibration &cal, const BME680_RawSample &raw, BME680_Sample &sample)
+{
+	sample.valid = 0;
+	if (raw.channels & (1 << BME680_Channel::TEMPERATURE))
+	{
+		double adc = raw.temperature;
+		double var1 = ((adc / 16384.0) - (cal.par_t1 / 1024.0)) * cal.par_t2;
+		double d = (adc / 131072.0) - (cal.par_t1 / 8192.0);
+		double var2 = d * d * (cal.par_t3 * 16.0);
+		double t_fine = var1 + var2;
+		double tc = t_fine / 5120.0;
+		sample.set(BME680_Channel::TEMPERATURE, tc);
+
+		if (raw.channels & (1 << BME680_Channel::PRESSURE))
+		{
+			var1 = (t_fine / 2.0) - 64000.0;
+			var2 = var1 * var1 * (cal.par_p6 / 131072.0);
+			var2 = var2 + (var1 * cal.par_p5 * 2.0);
+			var2 = (var2 / 4.0) + (cal.par_p4 * 65536.0);
+			var1 = (((cal.par_p3 * var1 * var1) / 16384.0) + (cal.par_p2 * var1)) / 524288.0;
+			var1 = (1.0 + (var1 / 32768.0)) * cal.par_p1;
+			double p = 0;
+			if (var1 != 0)
+			{
+				p = 1048576.0 - raw.pressure;
+				p = ((p - (var2 / 4096.0)) * 6250.0) / var1;
+				double var3 = (p / 256.0) * (p / 256.0) * (p / 256.0) * (cal.par_p10 / 131072.0);
+				var1 = (cal.par_p9 * p * p) / 2147483648.0;
+				var2 = p * (cal.par_p8 / 32768.0);
+				p = p + (var1 + var2 + var3 + (cal.par_p7 * 128.0)) / 16.0;
+			}
+			sample.set(BME680_Channel::PRESSURE, p);
+		}
+
+		if (raw.channels & (1 << BME680_Channel::HUMIDITY))
+		{
+			var1 = raw.humidity - ((cal.par_h1 * 16.0) + ((cal.par_h3 / 2.0) * tc));
+			var2 = var1 * ((cal.par_h2 / 262144.0) * (1.0 + ((cal.par_h4 / 16384.0) * tc)
+				+ ((cal.par_h5 / 1048576.0) * tc * tc)));
+			double var3 = cal.par_h6 / 16384.0;
+			double var4 = cal.par_h7 / 2097152.0;
+			double h = var2 + ((var3 + (var4 * tc)) * var2 * var2);
+			sample.set(BME680_Channel::HUMIDITY, h > 100.0 ? 100.0 : h < 0.0 ? 0.0 : h);
+		}
+	}
+
+	if (raw.channels & (1 << BME680_Channel::GAS))
+	{
+		uint8_t range = raw.gasRange() & 0x0f;
+		double var1 = 1340.0 + (5.0 * cal.range_sw_err);
+		double var2 = var1 * (1.0 + gasK1[range] / 100.0);
+		double var3 = 1.0 + (gasK2[range] / 100.0);
+		sample.set(BME680_Channel::GAS, 1.0 / (var3 * 0.000000125 * (double)(1u << range)
+			* (((raw.gas - 512.0) / var2) + 1.0)));
+	}
+	return sample.valid;
+}
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                         SINGLE PRECISION                                          *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+/* GCC vector extension: the operators compile to the widest instruction set enabled */
+typedef float vfloat __attribute__((vector_size(BME680_FLOAT_WIDTH * 4), may_alias));
+
+const char *BME680_floatPath()
+{
+#if defined(__AVX512F__)
+	return "avx512";
+#elif defined(__AVX__)
+	return "avx";
+#else
+	return "generic";
+#endif
+}
+
+void BME680_floatCalibration(float *data, uint32_t stride, uint32_t lane, const BME680_Calibration &cal)
+{
+	typedef BME680_FloatField F;
+	float *d = data + lane;
+	d[F::T1 * stride] = cal.par_t1 / 1024.0f;
+	d[F::T2 * stride] = cal.par_t2;
+	d[F::T3 * stride] = cal.par_t3 * 16.0f;
+	d[F::P1 * stride] = cal.par_p1;
+	d[F::P2 * stride] = cal.par_p2;
+	d[F::P3 * stride] = cal.par_p3 / 16384.0f;
+	d[F::P4 * stride] = cal.par_p4 * 65536.0f;
+	d[F::P5 * stride] = cal.par_p5 * 2.0f;
+	d[F::P6 * stride] = cal.par_p6 / 131072.0f;
+	d[F::P7 * stride] = cal.par_p7 * 128.0f;
+	d[F::P8 * stride] = cal.par_p8 / 32768.0f;
+	d[F::P9 * stride] = cal.par_p9 / 2147483648.0f;
+	d[F::P10 * stride] = cal.par_p10 / 131072.0f;
+	d[F::H1 * stride] = cal.par_h1 * 16.0f;
+	d[F::H2 * stride] = cal.par_h2 / 262144.0f;
+	d[F::H3 * stride] = cal.par_h3 / 2.0f;
+	d[F::H4 * stride] = cal.par_h4 / 16384.0f;
+	d[F::H5 * stride] = cal.par_h5 / 1048576.0f;
+	d[F::H6 * stride] = cal.par_h6 / 16384.0f;
+	d[F::H7 * stride] = cal.par_h7 / 2097152.0f;
+}
+
+void BME680_floatRaw(float *data, uint32_t stride, uint32_t lane, const BME680_RawSample &raw, int8_t rangeSwErr)
+{
+	typedef BME680_FloatField F;
+	float *d = data + lane;
+	uint8_t range = raw.gasRange() & 0x0f;
+	d[F::ADC_T * stride] = (float)raw.temperature;
+	d[F::ADC_P * stride] = (float)raw.pressure;
+	d[F::ADC_H * stride] = (float)raw.humidity;
+	d[F::ADC_G * stride] = (float)raw.gas;
+	d[F::GAS_VAR2 * stride] = (1340.0f + 5.0f * rangeSwErr) * (1.0f + gasK1[range] / 100.0f);
+	d[F::GAS_SCALE * stride] = (1.0f + gasK2[range] / 100.0f) * 0.000000125f * (float)(1u << range);
+}
+
+void BME680_compensateLanes(float *data, uint32_t stride, uint32_t count)
+{
+	typedef BME680_FloatField F;
+	const vfloat zero = {};
+#define ROW(f) (*(vfloat *)(data + (f) * stride + i))
+	/* Lanes up to the next multiple of the vector width are computed as well, they are within the row */
+	for (uint32_t i = 0; i < count; i += BME680_FLOAT_WIDTH)
+	{
+		/* Temperature */
+		vfloat adc = ROW(F::ADC_T);
+		vfloat t1 = ROW(F::T1);
+		vfloat var1 = (adc * (1.0f / 16384.0f) - t1) * ROW(F::T2);
+		vfloat d = adc * (1.0f / 131072.0f) - t1 * 0.125f;
+		vfloat t_fine = var1 + d * d * ROW(F::T3);
+		vfloat tc = t_fine * (1.0f / 5120.0f);
+		ROW(F::TEMPERATURE) = tc;
+
+		/* Pressure */
+		var1 = t_fine * 0.5f - 64000.0f;
+		vfloat var2 = var1 * var1 * ROW(F::P6) + var1 * ROW(F::P5);
+		var2 = var2 * 0.25f + ROW(F::P4);
+		var1 = (ROW(F::P3) * var1 * var1 + ROW(F::P2) * var1) * (1.0f / 524288.0f);
+		var1 = (1.0f + var1 * (1.0f / 32768.0f)) * ROW(F::P1);
+		vfloat p = ((1048576.0f - ROW(F::ADC_P)) - var2 * (1.0f / 4096.0f)) * 6250.0f / var1;
+		vfloat q = p * (1.0f / 256.0f);
+		p = p + (ROW(F::P9) * p * p + p * ROW(F::P8) + q * q * q * ROW(F::P10) + ROW(F::P7)) * (1.0f / 16.0f);
+		ROW(F::PRESSURE) = var1 != zero ? p : zero;
+
+		/* Humidity */
+		var1 = ROW(F::ADC_H) - (ROW(F::H1) + ROW(F::H3) * tc);
+		var2 = var1 * (ROW(F::H2) * (1.0f + ROW(F::H4) * tc + ROW(F::H5) * tc * tc));
+		vfloat h = var2 + (ROW(F::H6) + ROW(F::H7) * tc) * var2 * var2;
+		h = h > 100.0f ? zero + 100.0f : h;
+		ROW(F::HUMIDITY) = h < zero ? zero : h;
+
+		/* Gas */
+		ROW(F::GAS) = 1.0f / (ROW(F::GAS_SCALE) * ((ROW(F::ADC_G) - 512.0f) / ROW(F::GAS_VAR2) + 1.0f));
+	}
+#undef ROW
+}
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                        ACCURACY REPORT                                            *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+static void accumulate(BME680_FloatAccuracy &report, uint8_t channel, double value, double reference)
+{
+	double error = std::fabs(value - reference);
+	report.samples[channel]++;
+	report.meanError[channel] += error;
+	if (error > report.maxError[channel])
+		report.maxError[channel] = error;
+	if (reference != 0 && error / std::fabs(reference) > report.maxRelative[channel])
+		report.maxRelative[channel] = error / std::fabs(reference);
+}
+
+void BME680_floatAccuracy(const BME680_Calibration &cal, BME680_FloatAccuracy &report)
+{
+	static BME680_FloatBank<16> bank;
+	BME680_RawSample raws[16];
+	uint32_t lanes = 0;
+
+	for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+	{
+		report.samples[c] = 0;
+		report.maxError[c] = report.meanError[c] = report.maxRelative[c] = 0;
+	}
+	for (uint32_t lane = 0; lane < 16; lane++)
+		bank.setCalibration(lane, cal);
+
+	/* Grid over the ADC ranges, 32 x 32 x 16 x (gas: 1024 codes x 16 ranges spread over the grid) */
+	uint32_t n = 0;
+	for (uint32_t t = 0; t < 32; t++)
+	for (uint32_t p = 0; p < 32; p++)
+	for (uint32_t h = 0; h < 16; h++, n++)
+	{
+		BME680_RawSample &raw = raws[lanes];
+		raw = BME680_RawSample();
+		raw.temperature = 0x40000 + t * 0x40000 / 32;
+		raw.pressure = 0x30000 + p * 0x80000 / 32;
+		raw.humidity = (uint16_t)(0x3000 + h * 0x9000 / 16);
+		raw.gas = (uint16_t)(n & 0x3ff);
+		raw.gasStatus = (uint8_t)(BME680_Base::gas_r_lsb::gas_valid_r::mask | ((n >> 10) & 0x0f));
+		raw.channels = 0x0f;
+		bank.setRaw(lanes, raw);
+		if (++lanes < 16)
+			continue;
+
+		bank.compensate();
+		for (uint32_t lane = 0; lane < lanes; lane++)
+		{
+			BME680_Sample reference;
+			BME680_compensateDouble(cal, raws[lane], reference);
+			double tc = reference.value[BME680_Channel::TEMPERATURE];
+			double pa = reference.value[BME680_Channel::PRESSURE];
+			/* Only the operating range of the device */
+			if (tc < -40 || tc > 85)
+				continue;
+			accumulate(report, BME680_Channel::TEMPERATURE, bank.temperature(lane), tc);
+			if (pa >= 30000 && pa <= 110000)
+				accumulate(report, BME680_Channel::PRESSURE, bank.pressure(lane), pa);
+			accumulate(report, BME680_Channel::HUMIDITY, bank.humidity(lane), reference.value[BME680_Channel::HUMIDITY]);
+			accumulate(report, BME680_Channel::GAS, bank.gas(lane), reference.value[BME680_Channel::GAS]);
+		}
+		lanes = 0;
+	}
+
+	for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+		if (report.samples[c])
+			report.meanError[c] /= report.samples[c];
+}
@@ -0,0 +1,127 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_FloatCompensation.hpp
+ */
+
+#ifndef BME680_FLOATCOMPENSATION_HPP
+#define BME680_FLOATCOMPENSATION_HPP
+
+#include <cinttypes>
+#include "BME680_Calibration.hpp"
+#include "BME680_Measurement.hpp"
+#include "BME680_Sample.hpp"
+
+/*
+ * Floating point compensation (Bosch reference driver, floating point variant).
+ * BME680_compensateDouble is the double precision reference for one sample;
+ * BME680_FloatBank compensates many sensors at once in single precision.
+ */
+
+/* Compensate raw.channels into sample (degree Celsius, Pa, %, Ohm) in double precision, returns sample.valid */
+uint8_t BME680_compensateDouble(const BME680_Calibration &cal, const BME680_RawSample &raw, BME680_Sample &sample);
+
+/* Rows of the struct-of-arrays layout, one lane (column) per sensor */
+struct BME680_FloatField
+{
+	enum
+	{
+		/* Calibration, scaled as used by the formulas */
+		T1, T2, T3,
+		P1, P2, P3, P4, P5, P6, P7, P8, P9, P10,
+		H1, H2, H3, H4, H5, H6, H7,
+		/* Input: ADC values, gas range terms */
+		ADC_T, ADC_P, ADC_H, ADC_G, GAS_VAR2, GAS_SCALE,
+		/* Output */
+		TEMPERATURE, PRESSURE, HUMIDITY, GAS,
+		COUNT
+	};
+};
+
+/* Vector width used by BME680_compensateLanes: 16 (AVX-512), 8 (AVX/AVX2) or 4 (SSE, NEON) lanes */
+#if defined(__AVX512F__)
+#define BME680_FLOAT_WIDTH 16
+#elif defined(__AVX__)
+#define BME680_FLOAT_WIDTH 8
+#else
+#define BME680_FLOAT_WIDTH 4
+#endif
+
+/* Instruction set of BME680_compensateLanes: "avx512", "avx", or "generic" */
+const char *BME680_floatPath();
+
+/*
+ * Compensate lanes [0, count) of a row-major block of BME680_FloatField::COUNT rows.
+ * data must be aligned to 64 bytes and stride (floats per row) a multiple of 16.
+ * All four outputs are computed for every lane, valid or not.
+ */
+void BME680_compensateLanes(float *data, uint32_t stride, uint32_t count);
+/* Fill the calibration rows of a lane */
+void BME680_floatCalibration(float *data, uint32_t stride, uint32_t lane, const BME680_Calibration &cal);
+/* Fill the input rows of a lane, range_sw_err is needed for the gas terms */
+void BME680_floatRaw(float *data, uint32_t stride, uint32_t lane, const BME680_RawSample &raw, int8_t rangeSwErr);
+
+/*
+ * Latest samples of a fleet of up to LANES sensors (a multiple of 16), compensated in one pass.
+ * Pressure and humidity need the temperature of the same sample: a lane without it
+ * reports P and H invalid.
+ */
+template <uint32_t LANES>
+class BME680_FloatBank
+{
+	typedef char lanes_multiple_of_16[LANES % 16 == 0 ? 1 : -1];
+
+public:
+	void setCalibration(uint32_t lane, const BME680_Calibration &cal)
+	{
+		BME680_floatCalibration(&data[0][0], LANES, lane, cal);
+		rangeSwErr[lane] = cal.range_sw_err;
+	}
+
+	void setRaw(uint32_t lane, const BME680_RawSample &raw)
+	{
+		BME680_floatRaw(&data[0][0], LANES, lane, raw, rangeSwErr[lane]);
+		uint8_t c = raw.channels;
+		if (!(c & (1 << BME680_Channel::TEMPERATURE)))
+			c &= (uint8_t)~((1 << BME680_Channel::PRESSURE) | (1 << BME680_Channel::HUMIDITY));
+		valid[lane] = c;
+	}
+
+	/* Compensate the first count lanes */
+	void compensate(uint32_t count = LANES) { BME680_compensateLanes(&data[0][0], LANES, count); }
+
+	float temperature(uint32_t lane) const { return data[BME680_FloatField::TEMPERATURE][lane]; } // degree Celsius
+	float pressure(uint32_t lane) const { return data[BME680_FloatField::PRESSURE][lane]; } // Pa
+	float humidity(uint32_t lane) const { return data[BME680_FloatField::HUMIDITY][lane]; } // %
+	float gas(uint32_t lane) const { return data[BME680_FloatField::GAS][lane]; } // Ohm
+	/* Bit (1 << BME680_Channel::x) per valid channel */
+	uint8_t channels(uint32_t lane) const { return valid[lane]; }
+
+	/* Row of a field, for vectorized post-processing */
+	const float *row(uint32_t field) const { return data[field]; }
+
+private:
+	float data[BME680_FloatField::COUNT][LANES] __attribute__((aligned(64)));
+	int8_t rangeSwErr[LANES];
+	uint8_t valid[LANES];
+};
+
+/* Deviation of the single precision bank from the double precision reference */
+struct BME680_FloatAccuracy
+{
+	uint32_t samples[BME680_Channel::COUNT];
+	double maxError[BME680_Channel::COUNT]; // absolute, in the unit of the channel
+	double meanError[BME680_Channel::COUNT];
+	double maxRelative[BME680_Channel::COUNT];
+};
+
+/*
+ * Compare both implementations over a grid of ADC values covering the operating range
+ * (-40..85 degree Celsius, 300..1100 hPa, 0..100 %, all gas ranges) for one calibration.
+ */
+void BME680_floatAccuracy(const BME680_Calibration &cal, BME680_FloatAccuracy &report);
+
+#endif
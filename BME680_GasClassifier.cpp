@@ -0,0 +1,161 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_GasClassifier.cpp
+ */
+
+#include <cstring>
+#include "BME680_GasClassifier.hpp"
+
+static const char BME680_MODEL_MAGIC[8] = { 'B', 'M', 'E', '6', '8', '0', 'M', '1' };
+
+static uint32_t le32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static float leFloat(const uint8_t *p)
+{
+	uint32_t bits = le32(p);
+	float value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+bool BME680_GasClassifier::load(const uint8_t *blob, uint32_t size)
+{
+	inputCount = layerCount = 0;
+	if (size < 12 || memcmp(blob, BME680_MODEL_MAGIC, sizeof(BME680_MODEL_MAGIC)))
+		return false;
+	uint8_t n = blob[8], layers = blob[9];
+	if (!n || n > MAX_INPUTS || !layers || layers > MAX_LAYERS)
+		return false;
+
+	const uint8_t *p = blob + 12, *end = blob + size;
+	if ((uint32_t)(end - p) < 8u * n)
+		return false;
+	for (uint8_t i = 0; i < n; i++, p += 4)
+		mean[i] = leFloat(p);
+	for (uint8_t i = 0; i < n; i++, p += 4)
+		scale[i] = leFloat(p);
+
+	uint8_t in = n;
+	for (uint8_t l = 0; l < layers; l++)
+	{
+		Layer &L = layer[l];
+		if (end - p < 4)
+			return false;
+		L.outputs = p[0];
+		L.activation = p[1];
+		p += 4;
+		uint32_t weights = ((uint32_t)L.outputs * in + 3) & ~3u;
+		if (!L.outputs || L.outputs > MAX_WIDTH || L.activation > BME680_Activation::RELU
+			|| (uint32_t)(end - p) < 8u * L.outputs + weights)
+			return false;
+		for (uint8_t o = 0; o < L.outputs; o++, p += 4)
+			L.multiplier[o] = leFloat(p);
+		for (uint8_t o = 0; o < L.outputs; o++, p += 4)
+			L.bias[o] = (int32_t)le32(p);
+		L.weights = (const int8_t *)p;
+		p += weights;
+		in = L.outputs;
+	}
+	if (p != end)
+		return false;
+	inputCount = n;
+	layerCount = layers;
+	return true;
+}
+
+static int8_t saturate(float x)
+{
+	/* Clamp before the conversion: a float out of the int32 range (or NaN) has no defined conversion */
+	if (!(x == x))
+		return 0;
+	if (x > 127.0f)
+		x = 127.0f;
+	else if (x < -127.0f)
+		x = -127.0f;
+	return (int8_t)(x < 0.0f ? x - 0.5f : x + 0.5f);
+}
+
+uint8_t BME680_GasClassifier::classify(const float *features, float *scores) const
+{
+	if (!layerCount)
+		return 0;
+	int8_t buffer[2][MAX_WIDTH > MAX_INPUTS ? MAX_WIDTH : MAX_INPUTS];
+	int8_t *q = buffer[0], *next = buffer[1];
+	for (uint8_t i = 0; i < inputCount; i++)
+		q[i] = saturate((features[i] - mean[i]) * scale[i]);
+
+	uint8_t in = inputCount;
+	float best = 0.0f;
+	uint8_t result = 0;
+	for (uint8_t l = 0; l < layerCount; l++)
+	{
+		const Layer &L = layer[l];
+		bool last = l + 1 == layerCount;
+		const int8_t *w = L.weights;
+		for (uint8_t o = 0; o < L.outputs; o++, w += in)
+		{
+			/* Products of two int8 fit 15 bits, 64 of them and the bias fit an int32 */
+			int32_t acc = L.bias[o];
+			for (uint8_t i = 0; i < in; i++)
+				acc += (int32_t)w[i] * q[i];
+			if (L.activation == BME680_Activation::RELU && acc < 0)
+				acc = 0;
+			float y = acc * L.multiplier[o];
+			if (!last)
+				next[o] = saturate(y);
+			else
+			{
+				if (scores)
+					scores[o] = y;
+				if (!o || y > best)
+				{
+					best = y;
+					result = o;
+				}
+			}
+		}
+		int8_t *t = q;
+		q = next;
+		next = t;
+		in = L.outputs;
+	}
+	return result;
+}
+
+void BME680_GasClassifier::classify(const float *rows, uint32_t stride, uint32_t count, uint8_t *classes) const
+{
+	for (uint32_t r = 0; r < count; r++)
+		classes[r] = classify(rows + r * stride);
+}
+
+double BME680_classifierRate(const BME680_GasClassifier &model, const float *rows, uint32_t stride,
+	uint32_t count, BME680_Clock &clock, uint32_t minUs)
+{
+	if (!count)
+		return 0.0;
+	uint8_t classes[256];
+	uint32_t batch = count < sizeof(classes) ? count : sizeof(classes);
+	uint64_t done = 0, start = clock.micros(), elapsed = 0;
+	uint32_t next = 0;
+	uint8_t sink = 0;
+	while (elapsed < minUs || !done)
+	{
+		uint32_t n = count - next < batch ? count - next : batch;
+		model.classify(rows + (uint64_t)next * stride, stride, n, classes);
+		sink ^= classes[n - 1];
+		done += n;
+		next = next + n < count ? next + n : 0;
+		elapsed = clock.micros() - start;
+	}
+	/* Keep the results alive so the loop is not optimized away */
+	volatile uint8_t keep = sink;
+	(void)keep;
+	return elapsed ? done * 1e6 / elapsed : 0.0;
+}
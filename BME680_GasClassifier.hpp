@@ -0,0 +1,88 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_GasClassifier.hpp
+ */
+
+#ifndef BME680_GASCLASSIFIER_HPP
+#define BME680_GASCLASSIFIER_HPP
+
+#include <cinttypes>
+#include "BME680_Clock.hpp"
+
+/*
+ * Model blob, little endian, as written by gen/gas_model.py:
+ *
+ *   char    magic[8]             "BME680M1"
+ *   uint8   inputs, layers, 0, 0
+ *   float   mean[inputs]         input quantization: q = round((x - mean) * scale)
+ *   float   scale[inputs]
+ *   per layer:
+ *   uint8   outputs, activation (BME680_Activation), 0, 0
+ *   float   multiplier[outputs]  accumulator to the next layer's input (or to a score)
+ *   int32   bias[outputs]        in accumulator units
+ *   int8    weights[outputs][layer inputs], padded with zeros to a multiple of 4 bytes
+ *
+ * A linear model is a single layer; the outputs of the last layer are class scores.
+ */
+struct BME680_Activation
+{
+	static const uint8_t LINEAR = 0;
+	static const uint8_t RELU = 1;
+};
+
+/*
+ * Int8 linear model or MLP over gas feature rows (BME680_GasFeatureBank). load() checks
+ * the blob and keeps pointers to its weights, which must stay valid (e.g. a constant
+ * array or a mapped file); the scales and biases are copied. Nothing is allocated,
+ * activations live on the stack.
+ */
+class BME680_GasClassifier
+{
+public:
+	static const uint8_t MAX_INPUTS = 64;
+	static const uint8_t MAX_WIDTH = 64; // outputs of a layer
+	static const uint8_t MAX_LAYERS = 4;
+
+	BME680_GasClassifier() : inputCount(0), layerCount(0) {}
+
+	/* Check and take a model blob, false if it is damaged or exceeds the limits above */
+	bool load(const uint8_t *blob, uint32_t size);
+
+	uint8_t inputs() const { return inputCount; }
+	/* Number of classes, 0 without a model */
+	uint8_t classes() const { return layerCount ? layer[layerCount - 1].outputs : 0; }
+
+	/* Class of one feature row (inputs() floats); scores, if given, gets classes() values */
+	uint8_t classify(const float *features, float *scores = 0) const;
+	/* Classes of count rows, stride floats apart (e.g. BME680_GasFeatureBank::features()) */
+	void classify(const float *rows, uint32_t stride, uint32_t count, uint8_t *classes) const;
+
+private:
+	struct Layer
+	{
+		uint8_t outputs;
+		uint8_t activation;
+		const int8_t *weights;
+		float multiplier[MAX_WIDTH];
+		int32_t bias[MAX_WIDTH];
+	};
+
+	uint8_t inputCount;
+	uint8_t layerCount;
+	float mean[MAX_INPUTS];
+	float scale[MAX_INPUTS];
+	Layer layer[MAX_LAYERS];
+};
+
+/*
+ * Classification rate of the calling thread in rows per second: classify 'rows'
+ * (count rows, stride floats apart) in turn for at least minUs on the given clock.
+ */
+double BME680_classifierRate(const BME680_GasClassifier &model, const float *rows, uint32_t stride,
+	uint32_t count, BME680_Clock &clock, uint32_t minUs = 1000000);
+
+#endif
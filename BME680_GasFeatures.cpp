@@ -0,0 +1,50 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_GasFeatures.cpp
+ */
+
+#include "BME680_GasFeatures.hpp"
+
+bool BME680_gasFeatures(const float *matrix, uint32_t rows, uint8_t steps, float *out, uint32_t stride)
+{
+	if (!rows || steps < 2 || steps > 10 || stride < BME680_GasFeature::COUNT(steps))
+	{
+		for (uint32_t f = 0; f < stride; f++)
+			out[f] = 0.0f;
+		return false;
+	}
+
+	/* Mean ln(R) per step over the window */
+	float mean[10] = { 0 };
+	for (uint32_t r = 0; r < rows; r++)
+		for (uint8_t s = 0; s < steps; s++)
+			mean[s] += matrix[r * steps + s];
+	float scale = 1.0f / rows;
+	for (uint8_t s = 0; s < steps; s++)
+		mean[s] *= scale;
+
+	for (uint8_t i = 1; i < steps; i++)
+	{
+		out[BME680_GasFeature::RATIO(i)] = mean[i] - mean[i - 1];
+		out[BME680_GasFeature::NORMALIZED(i, steps)] = mean[i] - mean[0];
+	}
+
+	/* Least squares slope over x = 0 .. steps-1: sum((x - xbar) * y) / sum((x - xbar)^2) */
+	float xbar = (steps - 1) * 0.5f;
+	float num = 0.0f, den = 0.0f;
+	for (uint8_t s = 0; s < steps; s++)
+	{
+		num += (s - xbar) * mean[s];
+		den += (s - xbar) * (s - xbar);
+	}
+	out[BME680_GasFeature::SLOPE(steps)] = num / den;
+	out[BME680_GasFeature::LEVEL(steps)] = mean[0];
+
+	for (uint32_t f = BME680_GasFeature::COUNT(steps); f < stride; f++)
+		out[f] = 0.0f;
+	return true;
+}
@@ -0,0 +1,138 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_GasFeatures.hpp
+ */
+
+#ifndef BME680_GASFEATURES_HPP
+#define BME680_GASFEATURES_HPP
+
+#include <cinttypes>
+#include <cmath>
+#include "BME680_Measurement.hpp"
+#include "BME680_Sample.hpp"
+
+/*
+ * Layout of a gas fingerprint of a heater profile with 'steps' steps, computed from
+ * the mean ln(R) of each step over the rolling window:
+ *
+ *   RATIO(i)       i = 1 .. steps-1   ln(R_i / R_i-1), between adjacent steps
+ *   NORMALIZED(i)  i = 1 .. steps-1   ln(R_i / R_0), relative to the step 0 baseline
+ *   SLOPE                             least squares slope of ln(R) over the step index
+ *   LEVEL                             ln(R_0 / 1 Ohm), the baseline itself
+ *
+ * 2 * steps features, followed by zeros up to the stride of the feature rows.
+ */
+struct BME680_GasFeature
+{
+	static uint32_t RATIO(uint8_t i) { return i - 1; }
+	static uint32_t NORMALIZED(uint8_t i, uint8_t steps) { return steps - 2 + i; }
+	static uint32_t SLOPE(uint8_t steps) { return 2 * steps - 2; }
+	static uint32_t LEVEL(uint8_t steps) { return 2 * steps - 1; }
+	static uint32_t COUNT(uint8_t steps) { return 2 * steps; }
+};
+
+/*
+ * Features of a rolling matrix of 'rows' complete profiles (row-major, 'steps' ln(R)
+ * values per row) into out[0 .. stride), see BME680_GasFeature. Returns false, with
+ * out all zero, for an empty window, steps outside 2 .. 10 or a stride below 2 * steps.
+ */
+bool BME680_gasFeatures(const float *matrix, uint32_t rows, uint8_t steps, float *out, uint32_t stride);
+
+/*
+ * Gas fingerprints of up to SENSORS sensors running a heater profile of STEPS steps in
+ * order (e.g. BME680_HeaterSequencer). Each gas result is tagged with its heater step
+ * (gas_meas_index_0); a profile whose steps arrive complete and in order enters the
+ * sensor's rolling matrix of the last DEPTH profiles, an interrupted one is dropped.
+ * Feature rows of all sensors lie in one 64 byte aligned block, STRIDE (a multiple
+ * of 16) floats apart, ready for vectorized models (see features()).
+ * The alignment holds for static and automatic banks. operator new only guarantees it
+ * from C++17 on: before, allocate the memory aligned (posix_memalign) and construct the
+ * bank in place.
+ */
+template <uint32_t SENSORS, uint8_t STEPS = 10, uint8_t DEPTH = 8>
+class BME680_GasFeatureBank
+{
+	typedef char steps_2_to_10[STEPS >= 2 && STEPS <= 10 ? 1 : -1];
+	typedef char depth_at_least_1[DEPTH >= 1 ? 1 : -1];
+
+public:
+	static const uint32_t FEATURES = 2 * STEPS;
+	static const uint32_t STRIDE = (FEATURES + 15) / 16 * 16;
+
+	BME680_GasFeatureBank() : profiles(0), dropped(0) { reset(); }
+
+	/*
+	 * Add the gas resistance in Ohm of heater step 'index' of a sensor. Returns true when
+	 * it completed a profile and the sensor's features were updated.
+	 */
+	bool add(uint32_t sensor, uint8_t index, double resistance)
+	{
+		if (sensor >= SENSORS || index >= STEPS || !(resistance > 0.0))
+			return false;
+		if (index != next[sensor])
+		{
+			if (next[sensor])
+				dropped++;
+			next[sensor] = 0;
+			if (index)
+				return false;
+		}
+		current[sensor][index] = (float)log(resistance);
+		if (++next[sensor] < STEPS)
+			return false;
+
+		next[sensor] = 0;
+		float *row = matrix[sensor][head[sensor]];
+		for (uint8_t s = 0; s < STEPS; s++)
+			row[s] = current[sensor][s];
+		head[sensor] = (uint8_t)((head[sensor] + 1) % DEPTH);
+		if (rows[sensor] < DEPTH)
+			rows[sensor]++;
+		BME680_gasFeatures(&matrix[sensor][0][0], rows[sensor], STEPS, out[sensor], STRIDE);
+		profiles++;
+		return true;
+	}
+
+	/* Add a compensated sample, its heater step taken from raw (gas_meas_index_0) */
+	bool add(uint32_t sensor, const BME680_RawSample &raw, const BME680_Sample &sample)
+	{
+		if (!sample.isValid(BME680_Channel::GAS))
+			return false;
+		return add(sensor, raw.gasIndex(), sample.value[BME680_Channel::GAS]);
+	}
+
+	/* Feature row of a sensor, all zero until its first complete profile */
+	const float *features(uint32_t sensor) const { return out[sensor]; }
+	/* All feature rows, SENSORS x STRIDE floats */
+	const float *features() const { return &out[0][0]; }
+	/* Complete profiles in the window of a sensor (0 .. DEPTH) */
+	uint8_t window(uint32_t sensor) const { return rows[sensor]; }
+
+	/* Forget all profiles */
+	void reset()
+	{
+		for (uint32_t i = 0; i < SENSORS; i++)
+		{
+			next[i] = head[i] = rows[i] = 0;
+			for (uint32_t f = 0; f < STRIDE; f++)
+				out[i][f] = 0.0f;
+		}
+	}
+
+	uint32_t profiles; // complete profiles added
+	uint32_t dropped; // profiles interrupted by a missing or out of order step
+
+private:
+	float out[SENSORS][STRIDE] __attribute__((aligned(64)));
+	float matrix[SENSORS][DEPTH][STEPS];
+	float current[SENSORS][STEPS];
+	uint8_t next[SENSORS]; // expected heater step
+	uint8_t head[SENSORS]; // matrix row written next
+	uint8_t rows[SENSORS];
+};
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_GasWaitTuner.cpp
+ */
+
+#include "BME680.hpp"
+#include "BME680_GasWaitTuner.hpp"
+#include "BME680_Timing.hpp"
+
+BME680_GasWaitProfile::BME680_GasWaitProfile()
+	: count(0)
+{
+	for (uint8_t i = 0; i < STEPS; i++)
+		resHeat[i] = gasWait[i] = 0;
+}
+
+uint32_t BME680_GasWaitProfile::waitMs(uint8_t step) const
+{
+	return step < STEPS ? BME680_Timing::gasWait(gasWait[step]) : 0;
+}
+
+uint8_t BME680_GasWaitProfile::apply(BME680_HeaterSequencer &seq, uint8_t *steps) const
+{
+	uint8_t loaded = 0;
+	for (uint8_t i = 0; i < count && i < STEPS; i++)
+	{
+		/* A step that did not stabilise within the limit would only give unstable results */
+		if (!gasWait[i])
+			continue;
+		seq.setStep(loaded, resHeat[i], (uint16_t)waitMs(i));
+		if (steps)
+			steps[loaded] = i;
+		loaded++;
+	}
+	if (loaded)
+		seq.setCount(loaded);
+	return loaded;
+}
+
+BME680_GasWaitTuner::BME680_GasWaitTuner(BME680_Measurement &measurement, BME680_Clock &clock)
+	: measurements(0), candidates(0), meas(measurement), clk(clock), trials(5), margin(10),
+	  limit(BME680_HeaterSequencer::MAX_WAIT), interval(0)
+{
+}
+
+void BME680_GasWaitTuner::setTrials(uint8_t n)
+{
+	trials = n ? n : 1;
+}
+
+void BME680_GasWaitTuner::setLimit(uint16_t ms)
+{
+	limit = ms < 1 ? 1 : ms > BME680_HeaterSequencer::MAX_WAIT ? BME680_HeaterSequencer::MAX_WAIT : ms;
+}
+
+bool BME680_GasWaitTuner::stable(BME680_Base &dev, uint8_t step, uint8_t code)
+{
+	candidates++;
+	dev.write(BME680_Base::Gas_wait_0::__address + step, code, 8);
+	meas.setGas(step, code);
+	for (uint8_t i = 0; i < trials; i++)
+	{
+		if (interval)
+			clk.sleep(interval * 1000);
+		clk.sleep(meas.start(BME680_Mode::GAS));
+		measurements++;
+		BME680_RawSample raw;
+		/* A failed read counts as unstable, the search then errs on the long side */
+		if (meas.fetch(raw, clk, 5, 1000) != BME680_ReadStatus::OK || raw.gasClass() != BME680_GasClass::VALID)
+			return false;
+	}
+	return true;
+}
+
+uint8_t BME680_GasWaitTuner::tuneStep(BME680_Base &dev, uint8_t step, uint8_t resHeat)
+{
+	if (step >= BME680_GasWaitProfile::STEPS)
+		return 0;
+	dev.write(BME680_Base::Res_heat_0::__address + step, resHeat, 8);
+
+	/* Invariant: waits <= low are unstable (0: none tried), 'high' is stable */
+	uint32_t low = 0;
+	uint32_t high = BME680_Timing::gasWait(BME680_Timing::gasWaitCodeAtMost(limit));
+	if (!stable(dev, step, BME680_Timing::gasWaitCode(high)))
+		return 0;
+	for (;;)
+	{
+		/* Shortest encodable wait >= the middle, or the next one above low */
+		uint32_t candidate = BME680_Timing::gasWait(BME680_Timing::gasWaitCode((low + high) / 2 + 1));
+		if (candidate >= high)
+			candidate = BME680_Timing::gasWait(BME680_Timing::gasWaitCode(low + 1));
+		if (candidate >= high)
+			break;
+		if (stable(dev, step, BME680_Timing::gasWaitCode(candidate)))
+			high = candidate;
+		else
+			low = candidate;
+	}
+
+	uint32_t tuned = high + (high * margin + 99) / 100;
+	uint8_t code = BME680_Timing::gasWaitCode(tuned < limit ? tuned : limit);
+	if (BME680_Timing::gasWait(code) > limit)
+		code = BME680_Timing::gasWaitCodeAtMost(limit);
+	dev.write(BME680_Base::Gas_wait_0::__address + step, code, 8);
+	return code;
+}
+
+uint8_t BME680_GasWaitTuner::tune(BME680_Base &dev, BME680_GasWaitProfile &profile)
+{
+	uint8_t found = 0;
+	for (uint8_t i = 0; i < profile.count && i < BME680_GasWaitProfile::STEPS; i++)
+	{
+		profile.gasWait[i] = tuneStep(dev, i, profile.resHeat[i]);
+		if (profile.gasWait[i])
+			found++;
+	}
+	return found;
+}
@@ -0,0 +1,99 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_GasWaitTuner.hpp
+ */
+
+#ifndef BME680_GASWAITTUNER_HPP
+#define BME680_GASWAITTUNER_HPP
+
+#include <cinttypes>
+#include "BME680_Core.hpp"
+#include "BME680_Clock.hpp"
+#include "BME680_HeaterSequencer.hpp"
+#include "BME680_Measurement.hpp"
+
+/*
+ * Heater profile: Res_heat_x target and Gas_wait_x value of steps 0 .. count - 1.
+ * Saved and loaded per device with BME680_CalibrationCache.
+ */
+struct BME680_GasWaitProfile
+{
+	static const uint8_t STEPS = 10;
+	static const uint8_t SIZE = 1 + 2 * STEPS; // size in the cache file: count, then resHeat and gasWait per step
+
+	uint8_t count;
+	uint8_t resHeat[STEPS];
+	uint8_t gasWait[STEPS]; // Gas_wait_x values, 0 = not tuned
+
+	BME680_GasWaitProfile();
+
+	/* Heater wait of a step in ms */
+	uint32_t waitMs(uint8_t step) const;
+	/*
+	 * Load the tuned steps into a sequencer (call seq.configure afterwards), returns their number.
+	 * Steps that were not tuned are left out, the following ones take their place: the
+	 * sequencer step, and so gas_meas_index_0 of the results, is then not the profile step.
+	 * If 'steps' is given, steps[i] is set to the profile step loaded as sequencer step i.
+	 * A BME680_GasFeatureBank sees the sequencer steps: its STEPS must be the returned
+	 * number, a bank of 'count' steps would wait for a step that never comes and complete
+	 * no profile; its features then belong to the profile steps steps[0 .. n - 1].
+	 */
+	uint8_t apply(BME680_HeaterSequencer &seq, uint8_t *steps = 0) const;
+};
+
+/*
+ * Search, per heater step, the shortest Gas_wait_x that gives heat_stab_r = 1 in
+ * 'trials' gas-only measurements in a row. The encodable waits are bisected between
+ * a wait known to be too short and one known to be stable, starting from 'limit';
+ * a candidate is rejected at its first unstable result, so most of the calibration
+ * time goes into the waits that pass. The result gets 'margin' percent on top.
+ *
+ *   BME680_GasWaitProfile profile;
+ *   profile.count = 3;  // resHeat[0..2] from BME680_Compensation::heaterResistance
+ *   tuner.tune(dev, profile);
+ *   cache.save(key, profile);
+ *
+ * Stability depends on where the heater starts from: 'interval' (ms between the
+ * measurements) should be the period of normal operation.
+ */
+class BME680_GasWaitTuner
+{
+public:
+	BME680_GasWaitTuner(BME680_Measurement &measurement, BME680_Clock &clock);
+
+	/* Stable results in a row needed to accept a wait (default 5) */
+	void setTrials(uint8_t trials);
+	/* Added to the shortest stable wait, in percent (default 10) */
+	void setMargin(uint8_t percent) { margin = percent; }
+	/* Longest wait tried, in ms (default and at most 4032) */
+	void setLimit(uint16_t ms);
+	/* Pause between measurements in ms (default 0) */
+	void setInterval(uint32_t ms) { interval = ms; }
+
+	/*
+	 * Tune one step with Res_heat_x = resHeat, returns its Gas_wait_x value including the
+	 * margin (at most the limit), or 0 if the heater does not stabilise within the limit.
+	 */
+	uint8_t tuneStep(BME680_Base &dev, uint8_t step, uint8_t resHeat);
+	/* Tune steps 0 .. profile.count - 1 (profile.resHeat is input), returns the number of stable steps */
+	uint8_t tune(BME680_Base &dev, BME680_GasWaitProfile &profile);
+
+	uint32_t measurements; // gas measurements made
+	uint32_t candidates; // waits tried
+
+private:
+	bool stable(BME680_Base &dev, uint8_t step, uint8_t code);
+
+	BME680_Measurement &meas;
+	BME680_Clock &clk;
+	uint8_t trials;
+	uint8_t margin;
+	uint16_t limit;
+	uint32_t interval;
+};
+
+#endif
@@ -0,0 +1,1231 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_HeaterRegisters.hpp
+ */
+
+#ifndef BME680_HEATERREGISTERS_HPP
+#define BME680_HEATERREGISTERS_HPP
+
+#include <cinttypes>
+
+/*
+ * Heater registers of BME680_Base: heater set-points: wait time, target resistance and initial current of the 10 steps.
+ * Include this header alone where only the constants are needed:
+ * BME680_HeaterRegisters::Gas_wait_9::__address is BME680_Base::Gas_wait_9::__address.
+ */
+struct BME680_HeaterRegisters
+{
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Gas_wait_9                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Gas_wait_9:
+	 * 5.3.3.3 Gas Sensor wait time
+	 * The time between the beginning of the heat phase and the start of gas sensor resistance
+	 * conversion depends on gas_wait_x setting as mentioned below.
+	 */
+	struct Gas_wait_9
+	{
+		static const uint16_t __address = 109;
+		
+		/* Bits gas_wait_mult: */
+		/* Gas sensor wait time multiplication factor  */
+		struct gas_wait_mult
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b11000000; // [6,7]
+			static const uint8_t X1 = 0b00; // 
+			static const uint8_t X4 = 0b01; // 
+			static const uint8_t X16 = 0b10; // 
+			static const uint8_t X64 = 0b11; // 
+		};
+		/* Bits gas_wait_val: */
+		/* 64 timer values with 1 ms step sizes, all zeros means no wait  */
+		struct gas_wait_val
+		{
+			static const uint8_t dflt = 0b000000; // 6'b0
+			static const uint8_t mask = 0b00111111; // [0,1,2,3,4,5]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Gas_wait_8                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Gas_wait_8:
+	 * 5.3.3.3 Gas Sensor wait time
+	 */
+	struct Gas_wait_8
+	{
+		static const uint16_t __address = 108;
+		
+		/* Bits gas_wait_mult: */
+		/* Gas sensor wait time multiplication factor  */
+		struct gas_wait_mult
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b11000000; // [6,7]
+			static const uint8_t X1 = 0b00; // 
+			static const uint8_t X4 = 0b01; // 
+			static const uint8_t X16 = 0b10; // 
+			static const uint8_t X64 = 0b11; // 
+		};
+		/* Bits gas_wait_val: */
+		/* 64 timer values with 1 ms step sizes, all zeros means no wait  */
+		struct gas_wait_val
+		{
+			static const uint8_t dflt = 0b000000; // 6'b0
+			static const uint8_t mask = 0b00111111; // [0,1,2,3,4,5]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Gas_wait_7                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Gas_wait_7:
+	 * 5.3.3.3 Gas Sensor wait time
+	 */
+	struct Gas_wait_7
+	{
+		static const uint16_t __address = 107;
+		
+		/* Bits gas_wait_mult: */
+		/* Gas sensor wait time multiplication factor  */
+		struct gas_wait_mult
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b11000000; // [6,7]
+			static const uint8_t X1 = 0b00; // 
+			static const uint8_t X4 = 0b01; // 
+			static const uint8_t X16 = 0b10; // 
+			static const uint8_t X64 = 0b11; // 
+		};
+		/* Bits gas_wait_val: */
+		/* 64 timer values with 1 ms step sizes, all zeros means no wait  */
+		struct gas_wait_val
+		{
+			static const uint8_t dflt = 0b000000; // 6'b0
+			static const uint8_t mask = 0b00111111; // [0,1,2,3,4,5]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Gas_wait_6                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Gas_wait_6:
+	 * 5.3.3.3 Gas Sensor wait time
+	 */
+	struct Gas_wait_6
+	{
+		static const uint16_t __address = 106;
+		
+		/* Bits gas_wait_mult: */
+		/* Gas sensor wait time multiplication factor  */
+		struct gas_wait_mult
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b11000000; // [6,7]
+			static const uint8_t X1 = 0b00; // 
+			static const uint8_t X4 = 0b01; // 
+			static const uint8_t X16 = 0b10; // 
+			static const uint8_t X64 = 0b11; // 
+		};
+		/* Bits gas_wait_val: */
+		/* 64 timer values with 1 ms step sizes, all zeros means no wait  */
+		struct gas_wait_val
+		{
+			static const uint8_t dflt = 0b000000; // 6'b0
+			static const uint8_t mask = 0b00111111; // [0,1,2,3,4,5]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Gas_wait_5                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Gas_wait_5:
+	 * 5.3.3.3 Gas Sensor wait time
+	 */
+	struct Gas_wait_5
+	{
+		static const uint16_t __address = 105;
+		
+		/* Bits gas_wait_mult: */
+		/* Gas sensor wait time multiplication factor  */
+		struct gas_wait_mult
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b11000000; // [6,7]
+			static const uint8_t X1 = 0b00; // 
+			static const uint8_t X4 = 0b01; // 
+			static const uint8_t X16 = 0b10; // 
+			static const uint8_t X64 = 0b11; // 
+		};
+		/* Bits gas_wait_val: */
+		/* 64 timer values with 1 ms step sizes, all zeros means no wait  */
+		struct gas_wait_val
+		{
+			static const uint8_t dflt = 0b000000; // 6'b0
+			static const uint8_t mask = 0b00111111; // [0,1,2,3,4,5]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Gas_wait_4                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Gas_wait_4:
+	 * 5.3.3.3 Gas Sensor wait time
+	 */
+	struct Gas_wait_4
+	{
+		static const uint16_t __address = 104;
+		
+		/* Bits gas_wait_mult: */
+		/* Gas sensor wait time multiplication factor  */
+		struct gas_wait_mult
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b11000000; // [6,7]
+			static const uint8_t X1 = 0b00; // 
+			static const uint8_t X4 = 0b01; // 
+			static const uint8_t X16 = 0b10; // 
+			static const uint8_t X64 = 0b11; // 
+		};
+		/* Bits gas_wait_val: */
+		/* 64 timer values with 1 ms step sizes, all zeros means no wait  */
+		struct gas_wait_val
+		{
+			static const uint8_t dflt = 0b000000; // 6'b0
+			static const uint8_t mask = 0b00111111; // [0,1,2,3,4,5]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Gas_wait_3                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Gas_wait_3:
+	 * 5.3.3.3 Gas Sensor wait time
+	 */
+	struct Gas_wait_3
+	{
+		static const uint16_t __address = 103;
+		
+		/* Bits gas_wait_mult: */
+		/* Gas sensor wait time multiplication factor  */
+		struct gas_wait_mult
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b11000000; // [6,7]
+			static const uint8_t X1 = 0b00; // 
+			static const uint8_t X4 = 0b01; // 
+			static const uint8_t X16 = 0b10; // 
+			static const uint8_t X64 = 0b11; // 
+		};
+		/* Bits gas_wait_val: */
+		/* 64 timer values with 1 ms step sizes, all zeros means no wait  */
+		struct gas_wait_val
+		{
+			static const uint8_t dflt = 0b000000; // 6'b0
+			static const uint8_t mask = 0b00111111; // [0,1,2,3,4,5]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Gas_wait_2                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Gas_wait_2:
+	 * 5.3.3.3 Gas Sensor wait time
+	 */
+	struct Gas_wait_2
+	{
+		static const uint16_t __address = 102;
+		
+		/* Bits gas_wait_mult: */
+		/* Gas sensor wait time multiplication factor  */
+		struct gas_wait_mult
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b11000000; // [6,7]
+			static const uint8_t X1 = 0b00; // 
+			static const uint8_t X4 = 0b01; // 
+			static const uint8_t X16 = 0b10; // 
+			static const uint8_t X64 = 0b11; // 
+		};
+		/* Bits gas_wait_val: */
+		/* 64 timer values with 1 ms step sizes, all zeros means no wait  */
+		struct gas_wait_val
+		{
+			static const uint8_t dflt = 0b000000; // 6'b0
+			static const uint8_t mask = 0b00111111; // [0,1,2,3,4,5]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Gas_wait_1                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Gas_wait_1:
+	 * 5.3.3.3 Gas Sensor wait time
+	 */
+	struct Gas_wait_1
+	{
+		static const uint16_t __address = 101;
+		
+		/* Bits gas_wait_mult: */
+		/* Gas sensor wait time multiplication factor  */
+		struct gas_wait_mult
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b11000000; // [6,7]
+			static const uint8_t X1 = 0b00; // 
+			static const uint8_t X4 = 0b01; // 
+			static const uint8_t X16 = 0b10; // 
+			static const uint8_t X64 = 0b11; // 
+		};
+		/* Bits gas_wait_val: */
+		/* 64 timer values with 1 ms step sizes, all zeros means no wait  */
+		struct gas_wait_val
+		{
+			static const uint8_t dflt = 0b000000; // 6'b0
+			static const uint8_t mask = 0b00111111; // [0,1,2,3,4,5]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Gas_wait_0                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Gas_wait_0:
+	 * 5.3.3.3 Gas Sensor wait time
+	 */
+	struct Gas_wait_0
+	{
+		static const uint16_t __address = 100;
+		
+		/* Bits gas_wait_mult: */
+		/* Gas sensor wait time multiplication factor  */
+		struct gas_wait_mult
+		{
+			static const uint8_t dflt = 0b00; // 2'b0
+			static const uint8_t mask = 0b11000000; // [6,7]
+			static const uint8_t X1 = 0b00; // 
+			static const uint8_t X4 = 0b01; // 
+			static const uint8_t X16 = 0b10; // 
+			static const uint8_t X64 = 0b11; // 
+		};
+		/* Bits gas_wait_val: */
+		/* 64 timer values with 1 ms step sizes, all zeros means no wait  */
+		struct gas_wait_val
+		{
+			static const uint8_t dflt = 0b000000; // 6'b0
+			static const uint8_t mask = 0b00111111; // [0,1,2,3,4,5]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Res_heat_9                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Res_heat_9:
+	 * 5.3.3.2 Target heater resistance
+	 */
+	struct Res_heat_9
+	{
+		static const uint16_t __address = 99;
+		
+		/* Bits res_heat: */
+		/* Decimal value that needs to be stored for achieving target heater resistance  */
+		struct res_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Res_heat_8                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Res_heat_8:
+	 * 5.3.3.2 Target heater resistance
+	 */
+	struct Res_heat_8
+	{
+		static const uint16_t __address = 98;
+		
+		/* Bits res_heat: */
+		/* Decimal value that needs to be stored for achieving target heater resistance  */
+		struct res_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Res_heat_7                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Res_heat_7:
+	 * 5.3.3.2 Target heater resistance
+	 */
+	struct Res_heat_7
+	{
+		static const uint16_t __address = 97;
+		
+		/* Bits res_heat: */
+		/* Decimal value that needs to be stored for achieving target heater resistance  */
+		struct res_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Res_heat_6                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Res_heat_6:
+	 * 5.3.3.2 Target heater resistance
+	 */
+	struct Res_heat_6
+	{
+		static const uint16_t __address = 96;
+		
+		/* Bits res_heat: */
+		/* Decimal value that needs to be stored for achieving target heater resistance  */
+		struct res_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Res_heat_5                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Res_heat_5:
+	 * 5.3.3.2 Target heater resistance
+	 */
+	struct Res_heat_5
+	{
+		static const uint16_t __address = 95;
+		
+		/* Bits res_heat: */
+		/* Decimal value that needs to be stored for achieving target heater resistance  */
+		struct res_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Res_heat_4                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Res_heat_4:
+	 * 5.3.3.2 Target heater resistance
+	 */
+	struct Res_heat_4
+	{
+		static const uint16_t __address = 94;
+		
+		/* Bits res_heat: */
+		/* Decimal value that needs to be stored for achieving target heater resistance  */
+		struct res_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Res_heat_3                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Res_heat_3:
+	 * 5.3.3.2 Target heater resistance
+	 */
+	struct Res_heat_3
+	{
+		static const uint16_t __address = 93;
+		
+		/* Bits res_heat: */
+		/* Decimal value that needs to be stored for achieving target heater resistance  */
+		struct res_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Res_heat_2                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Res_heat_2:
+	 * 5.3.3.2 Target heater resistance
+	 */
+	struct Res_heat_2
+	{
+		static const uint16_t __address = 92;
+		
+		/* Bits res_heat: */
+		/* Decimal value that needs to be stored for achieving target heater resistance  */
+		struct res_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Res_heat_1                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Res_heat_1:
+	 * 5.3.3.2 Target heater resistance
+	 */
+	struct Res_heat_1
+	{
+		static const uint16_t __address = 91;
+		
+		/* Bits res_heat: */
+		/* Decimal value that needs to be stored for achieving target heater resistance  */
+		struct res_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                          REG Res_heat_0                                           *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Res_heat_0:
+	 * 5.3.3.2 Target heater resistance
+	 */
+	struct Res_heat_0
+	{
+		static const uint16_t __address = 90;
+		
+		/* Bits res_heat: */
+		/* Decimal value that needs to be stored for achieving target heater resistance  */
+		struct res_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                         REG Idac_heat_9                                          *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG Idac_heat_9:
+	 * 5.3.3.1 Heater current
+	 * BME680 contains a heater control block that will inject enough current into the heater
+	 * resistance to achieve the requested heater temperature. There is a control loop which
+	 * periodically measures heater resistance value and adapts the value of current injected
+	 * from a DAC.
+	 * The heater operation could be speeded up by setting an initial heater current for a target
+	 * heater temperature by using register idac_heat_x<7:0>. This step is optional since the control
+	 * loop will find the current after a few iterations anyway. The current injected to the heater in
+	 * mA can be calculated by: (idac_heat_7_1 + 1) / 8, where idac_heat_7_1 is the decimal value
+	 * stored in idac_heat<7:1> (unsigned, value from 0 to 127).
+	 */
+	struct Idac_heat_9
+	{
+		static const uint16_t __address = 89;
+		
+		/* Bits idac_heat: */
+		/* idac_heat of particular heater set point */
+		struct idac_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                         REG Idac_heat_8                                          *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG Idac_heat_8:
+	 * 5.3.3.1 Heater current
+	 */
+	struct Idac_heat_8
+	{
+		static const uint16_t __address = 88;
+		
+		/* Bits idac_heat: */
+		/* idac_heat of particular heater set point */
+		struct idac_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                         REG Idac_heat_7                                          *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG Idac_heat_7:
+	 * 5.3.3.1 Heater current
+	 */
+	struct Idac_heat_7
+	{
+		static const uint16_t __address = 87;
+		
+		/* Bits idac_heat: */
+		/* idac_heat of particular heater set point */
+		struct idac_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                         REG Idac_heat_6                                          *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG Idac_heat_6:
+	 * 5.3.3.1 Heater current
+	 */
+	struct Idac_heat_6
+	{
+		static const uint16_t __address = 86;
+		
+		/* Bits idac_heat: */
+		/* idac_heat of particular heater set point */
+		struct idac_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                         REG Idac_heat_5                                          *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG Idac_heat_5:
+	 * 5.3.3.1 Heater current
+	 */
+	struct Idac_heat_5
+	{
+		static const uint16_t __address = 85;
+		
+		/* Bits idac_heat: */
+		/* idac_heat of particular heater set point */
+		struct idac_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                         REG Idac_heat_4                                          *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG Idac_heat_4:
+	 * 5.3.3.1 Heater current
+	 */
+	struct Idac_heat_4
+	{
+		static const uint16_t __address = 84;
+		
+		/* Bits idac_heat: */
+		/* idac_heat of particular heater set point */
+		struct idac_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                         REG Idac_heat_3                                          *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG Idac_heat_3:
+	 * 5.3.3.1 Heater current
+	 */
+	struct Idac_heat_3
+	{
+		static const uint16_t __address = 83;
+		
+		/* Bits idac_heat: */
+		/* idac_heat of particular heater set point */
+		struct idac_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                         REG Idac_heat_2                                          *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG Idac_heat_2:
+	 * 5.3.3.1 Heater current
+	 */
+	struct Idac_heat_2
+	{
+		static const uint16_t __address = 82;
+		
+		/* Bits idac_heat: */
+		/* idac_heat of particular heater set point */
+		struct idac_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                         REG Idac_heat_1                                          *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG Idac_heat_1:
+	 * 5.3.3.1 Heater current
+	 */
+	struct Idac_heat_1
+	{
+		static const uint16_t __address = 81;
+		
+		/* Bits idac_heat: */
+		/* idac_heat of particular heater set point */
+		struct idac_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                         REG Idac_heat_0                                          *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG Idac_heat_0:
+	 * 5.3.3.1 Heater current
+	 */
+	struct Idac_heat_0
+	{
+		static const uint16_t __address = 80;
+		
+		/* Bits idac_heat: */
+		/* idac_heat of particular heater set point */
+		struct idac_heat
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+};
+
+/* Set/get accessors of the heater registers, D implements read8 and write */
+template <class D>
+class BME680_HeaterAccess : public BME680_HeaterRegisters
+{
+public:
+	/* Set register Gas_wait_9 */
+	void setGas_wait_9(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Gas_wait_9::__address, value, 8);
+	}
+	
+	/* Get register Gas_wait_9 */
+	uint8_t getGas_wait_9()
+	{
+		return static_cast<D *>(this)->read8(Gas_wait_9::__address, 8);
+	}
+	
+	/* Set register Gas_wait_8 */
+	void setGas_wait_8(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Gas_wait_8::__address, value, 8);
+	}
+	
+	/* Get register Gas_wait_8 */
+	uint8_t getGas_wait_8()
+	{
+		return static_cast<D *>(this)->read8(Gas_wait_8::__address, 8);
+	}
+	
+	/* Set register Gas_wait_7 */
+	void setGas_wait_7(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Gas_wait_7::__address, value, 8);
+	}
+	
+	/* Get register Gas_wait_7 */
+	uint8_t getGas_wait_7()
+	{
+		return static_cast<D *>(this)->read8(Gas_wait_7::__address, 8);
+	}
+	
+	/* Set register Gas_wait_6 */
+	void setGas_wait_6(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Gas_wait_6::__address, value, 8);
+	}
+	
+	/* Get register Gas_wait_6 */
+	uint8_t getGas_wait_6()
+	{
+		return static_cast<D *>(this)->read8(Gas_wait_6::__address, 8);
+	}
+	
+	/* Set register Gas_wait_5 */
+	void setGas_wait_5(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Gas_wait_5::__address, value, 8);
+	}
+	
+	/* Get register Gas_wait_5 */
+	uint8_t getGas_wait_5()
+	{
+		return static_cast<D *>(this)->read8(Gas_wait_5::__address, 8);
+	}
+	
+	/* Set register Gas_wait_4 */
+	void setGas_wait_4(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Gas_wait_4::__address, value, 8);
+	}
+	
+	/* Get register Gas_wait_4 */
+	uint8_t getGas_wait_4()
+	{
+		return static_cast<D *>(this)->read8(Gas_wait_4::__address, 8);
+	}
+	
+	/* Set register Gas_wait_3 */
+	void setGas_wait_3(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Gas_wait_3::__address, value, 8);
+	}
+	
+	/* Get register Gas_wait_3 */
+	uint8_t getGas_wait_3()
+	{
+		return static_cast<D *>(this)->read8(Gas_wait_3::__address, 8);
+	}
+	
+	/* Set register Gas_wait_2 */
+	void setGas_wait_2(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Gas_wait_2::__address, value, 8);
+	}
+	
+	/* Get register Gas_wait_2 */
+	uint8_t getGas_wait_2()
+	{
+		return static_cast<D *>(this)->read8(Gas_wait_2::__address, 8);
+	}
+	
+	/* Set register Gas_wait_1 */
+	void setGas_wait_1(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Gas_wait_1::__address, value, 8);
+	}
+	
+	/* Get register Gas_wait_1 */
+	uint8_t getGas_wait_1()
+	{
+		return static_cast<D *>(this)->read8(Gas_wait_1::__address, 8);
+	}
+	
+	/* Set register Gas_wait_0 */
+	void setGas_wait_0(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Gas_wait_0::__address, value, 8);
+	}
+	
+	/* Get register Gas_wait_0 */
+	uint8_t getGas_wait_0()
+	{
+		return static_cast<D *>(this)->read8(Gas_wait_0::__address, 8);
+	}
+	
+	/* Set register Res_heat_9 */
+	void setRes_heat_9(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Res_heat_9::__address, value, 8);
+	}
+	
+	/* Get register Res_heat_9 */
+	uint8_t getRes_heat_9()
+	{
+		return static_cast<D *>(this)->read8(Res_heat_9::__address, 8);
+	}
+	
+	/* Set register Res_heat_8 */
+	void setRes_heat_8(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Res_heat_8::__address, value, 8);
+	}
+	
+	/* Get register Res_heat_8 */
+	uint8_t getRes_heat_8()
+	{
+		return static_cast<D *>(this)->read8(Res_heat_8::__address, 8);
+	}
+	
+	/* Set register Res_heat_7 */
+	void setRes_heat_7(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Res_heat_7::__address, value, 8);
+	}
+	
+	/* Get register Res_heat_7 */
+	uint8_t getRes_heat_7()
+	{
+		return static_cast<D *>(this)->read8(Res_heat_7::__address, 8);
+	}
+	
+	/* Set register Res_heat_6 */
+	void setRes_heat_6(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Res_heat_6::__address, value, 8);
+	}
+	
+	/* Get register Res_heat_6 */
+	uint8_t getRes_heat_6()
+	{
+		return static_cast<D *>(this)->read8(Res_heat_6::__address, 8);
+	}
+	
+	/* Set register Res_heat_5 */
+	void setRes_heat_5(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Res_heat_5::__address, value, 8);
+	}
+	
+	/* Get register Res_heat_5 */
+	uint8_t getRes_heat_5()
+	{
+		return static_cast<D *>(this)->read8(Res_heat_5::__address, 8);
+	}
+	
+	/* Set register Res_heat_4 */
+	void setRes_heat_4(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Res_heat_4::__address, value, 8);
+	}
+	
+	/* Get register Res_heat_4 */
+	uint8_t getRes_heat_4()
+	{
+		return static_cast<D *>(this)->read8(Res_heat_4::__address, 8);
+	}
+	
+	/* Set register Res_heat_3 */
+	void setRes_heat_3(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Res_heat_3::__address, value, 8);
+	}
+	
+	/* Get register Res_heat_3 */
+	uint8_t getRes_heat_3()
+	{
+		return static_cast<D *>(this)->read8(Res_heat_3::__address, 8);
+	}
+	
+	/* Set register Res_heat_2 */
+	void setRes_heat_2(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Res_heat_2::__address, value, 8);
+	}
+	
+	/* Get register Res_heat_2 */
+	uint8_t getRes_heat_2()
+	{
+		return static_cast<D *>(this)->read8(Res_heat_2::__address, 8);
+	}
+	
+	/* Set register Res_heat_1 */
+	void setRes_heat_1(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Res_heat_1::__address, value, 8);
+	}
+	
+	/* Get register Res_heat_1 */
+	uint8_t getRes_heat_1()
+	{
+		return static_cast<D *>(this)->read8(Res_heat_1::__address, 8);
+	}
+	
+	/* Set register Res_heat_0 */
+	void setRes_heat_0(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Res_heat_0::__address, value, 8);
+	}
+	
+	/* Get register Res_heat_0 */
+	uint8_t getRes_heat_0()
+	{
+		return static_cast<D *>(this)->read8(Res_heat_0::__address, 8);
+	}
+	
+	/* Set register Idac_heat_9 */
+	void setIdac_heat_9(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Idac_heat_9::__address, value, 8);
+	}
+	
+	/* Get register Idac_heat_9 */
+	uint8_t getIdac_heat_9()
+	{
+		return static_cast<D *>(this)->read8(Idac_heat_9::__address, 8);
+	}
+	
+	/* Set register Idac_heat_8 */
+	void setIdac_heat_8(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Idac_heat_8::__address, value, 8);
+	}
+	
+	/* Get register Idac_heat_8 */
+	uint8_t getIdac_heat_8()
+	{
+		return static_cast<D *>(this)->read8(Idac_heat_8::__address, 8);
+	}
+	
+	/* Set register Idac_heat_7 */
+	void setIdac_heat_7(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Idac_heat_7::__address, value, 8);
+	}
+	
+	/* Get register Idac_heat_7 */
+	uint8_t getIdac_heat_7()
+	{
+		return static_cast<D *>(this)->read8(Idac_heat_7::__address, 8);
+	}
+	
+	/* Set register Idac_heat_6 */
+	void setIdac_heat_6(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Idac_heat_6::__address, value, 8);
+	}
+	
+	/* Get register Idac_heat_6 */
+	uint8_t getIdac_heat_6()
+	{
+		return static_cast<D *>(this)->read8(Idac_heat_6::__address, 8);
+	}
+	
+	/* Set register Idac_heat_5 */
+	void setIdac_heat_5(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Idac_heat_5::__address, value, 8);
+	}
+	
+	/* Get register Idac_heat_5 */
+	uint8_t getIdac_heat_5()
+	{
+		return static_cast<D *>(this)->read8(Idac_heat_5::__address, 8);
+	}
+	
+	/* Set register Idac_heat_4 */
+	void setIdac_heat_4(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Idac_heat_4::__address, value, 8);
+	}
+	
+	/* Get register Idac_heat_4 */
+	uint8_t getIdac_heat_4()
+	{
+		return static_cast<D *>(this)->read8(Idac_heat_4::__address, 8);
+	}
+	
+	/* Set register Idac_heat_3 */
+	void setIdac_heat_3(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Idac_heat_3::__address, value, 8);
+	}
+	
+	/* Get register Idac_heat_3 */
+	uint8_t getIdac_heat_3()
+	{
+		return static_cast<D *>(this)->read8(Idac_heat_3::__address, 8);
+	}
+	
+	/* Set register Idac_heat_2 */
+	void setIdac_heat_2(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Idac_heat_2::__address, value, 8);
+	}
+	
+	/* Get register Idac_heat_2 */
+	uint8_t getIdac_heat_2()
+	{
+		return static_cast<D *>(this)->read8(Idac_heat_2::__address, 8);
+	}
+	
+	/* Set register Idac_heat_1 */
+	void setIdac_heat_1(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Idac_heat_1::__address, value, 8);
+	}
+	
+	/* Get register Idac_heat_1 */
+	uint8_t getIdac_heat_1()
+	{
+		return static_cast<D *>(this)->read8(Idac_heat_1::__address, 8);
+	}
+	
+	/* Set register Idac_heat_0 */
+	void setIdac_heat_0(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Idac_heat_0::__address, value, 8);
+	}
+	
+	/* Get register Idac_heat_0 */
+	uint8_t getIdac_heat_0()
+	{
+		return static_cast<D *>(this)->read8(Idac_heat_0::__address, 8);
+	}
+};
+
+#endif
@@ -0,0 +1,120 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_HeaterSequencer.cpp
+ */
+
+#include "BME680.hpp"
+#include "BME680_HeaterSequencer.hpp"
+#include "BME680_Timing.hpp"
+
+BME680_HeaterSequencer::BME680_HeaterSequencer()
+	: count(1), step(0), threshold(2), growth(50), maxWait(MAX_WAIT)
+{
+	for (uint8_t i = 0; i < STEPS; i++)
+	{
+		resHeat[i] = 0;
+		waitMs[i] = 0;
+		code[i] = 0;
+	}
+}
+
+void BME680_HeaterSequencer::setStep(uint8_t heaterStep, uint8_t resHeatValue, uint16_t ms)
+{
+	if (heaterStep >= STEPS)
+		return;
+	resHeat[heaterStep] = resHeatValue;
+	waitMs[heaterStep] = ms < MAX_WAIT ? ms : MAX_WAIT;
+	code[heaterStep] = BME680_Timing::gasWaitCode(waitMs[heaterStep]);
+	if (heaterStep >= count)
+		count = (uint8_t)(heaterStep + 1);
+}
+
+void BME680_HeaterSequencer::setCount(uint8_t steps)
+{
+	count = steps < 1 ? 1 : steps > STEPS ? STEPS : steps;
+	if (step >= count)
+		step = 0;
+}
+
+void BME680_HeaterSequencer::setAdaptation(uint8_t failures, uint16_t percent, uint16_t limit)
+{
+	threshold = failures ? failures : 1;
+	growth = percent;
+	maxWait = limit < MAX_WAIT ? limit : MAX_WAIT;
+}
+
+void BME680_HeaterSequencer::configure(BME680_Base &dev)
+{
+	for (uint8_t i = 0; i < count; i++)
+	{
+		dev.write(BME680_Base::Res_heat_0::__address + i, resHeat[i], 8);
+		dev.write(BME680_Base::Gas_wait_0::__address + i, code[i], 8);
+	}
+	step = 0;
+}
+
+uint32_t BME680_HeaterSequencer::wait(uint8_t heaterStep) const
+{
+	return heaterStep < STEPS ? BME680_Timing::gasWait(code[heaterStep]) : 0;
+}
+
+void BME680_HeaterSequencer::extend(BME680_Base &dev, uint8_t heaterStep)
+{
+	uint32_t current = BME680_Timing::gasWait(code[heaterStep]);
+	if (current >= maxWait)
+		return;
+	uint32_t longer = current + (current * growth + 99) / 100;
+	if (longer <= current)
+		longer = current + 1;
+	if (longer > maxWait)
+		longer = maxWait;
+	/* gasWaitCode rounds up, past maxWait near the limit */
+	uint8_t next = BME680_Timing::gasWaitCode(longer);
+	if (BME680_Timing::gasWait(next) > maxWait)
+		next = BME680_Timing::gasWaitCodeAtMost(maxWait);
+	if (BME680_Timing::gasWait(next) <= current)
+		return;
+	waitMs[heaterStep] = (uint16_t)longer;
+	code[heaterStep] = next;
+	dev.write(BME680_Base::Gas_wait_0::__address + heaterStep, code[heaterStep], 8);
+	steps[heaterStep].extensions++;
+}
+
+uint8_t BME680_HeaterSequencer::record(BME680_Base &dev, const BME680_RawSample &raw)
+{
+	/* A result of another step would be counted against the wrong wait */
+	if (raw.gasIndex() != step)
+		return BME680_GasClass::NOT_VALID;
+	BME680_HeaterStepStats &s = steps[step];
+	uint8_t result = raw.gasClass();
+	s.samples++;
+	if (result == BME680_GasClass::VALID)
+	{
+		s.valid++;
+		s.failures = 0;
+	}
+	else if (result == BME680_GasClass::NOT_STABLE)
+	{
+		s.notStable++;
+		if (++s.failures >= threshold)
+		{
+			extend(dev, step);
+			s.failures = 0;
+		}
+	}
+	else
+		s.notValid++; // no conversion took place, the heater is not to blame
+
+	step = (uint8_t)(step + 1 < count ? step + 1 : 0);
+	return result;
+}
+
+void BME680_HeaterSequencer::resetStats()
+{
+	for (uint8_t i = 0; i < STEPS; i++)
+		steps[i] = BME680_HeaterStepStats();
+}
@@ -0,0 +1,100 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_HeaterSequencer.hpp
+ */
+
+#ifndef BME680_HEATERSEQUENCER_HPP
+#define BME680_HEATERSEQUENCER_HPP
+
+#include <cinttypes>
+#include "BME680_Core.hpp"
+#include "BME680_Measurement.hpp"
+
+/* Gas results of one heater step, by BME680_GasClass */
+struct BME680_HeaterStepStats
+{
+	uint32_t samples; // results recorded
+	uint32_t valid;
+	uint32_t notValid;
+	uint32_t notStable;
+	uint8_t failures; // consecutive NOT_STABLE results
+	uint8_t extensions; // times Gas_wait_x was lengthened
+
+	BME680_HeaterStepStats() : samples(0), valid(0), notValid(0), notStable(0), failures(0), extensions(0) {}
+};
+
+/*
+ * Heater profile of up to 10 steps (Res_heat_x, Gas_wait_x), one step per gas
+ * measurement in turn:
+ *
+ *   seq.setStep(0, resHeat200, 30);
+ *   seq.setStep(1, resHeat300, 30);
+ *   seq.configure(dev);
+ *   meas.setGas(seq.current(), seq.waitCode());
+ *   ... meas.start(), meas.fetch(raw) ...
+ *   seq.record(dev, raw);     // classify, adapt the wait, move to the next step
+ *   meas.setGas(seq.current(), seq.waitCode());
+ *
+ * Results are classified from the gas_r_lsb status bits before any compensation
+ * (BME680_decodeGas does not flag unstable results). When a step fails to stabilise
+ * in 'threshold' consecutive measurements its Gas_wait_x is lengthened by 'growth'
+ * percent, up to the longest Gas_wait_x value not above maxWait, and written to the
+ * device at once.
+ */
+class BME680_HeaterSequencer
+{
+public:
+	static const uint8_t STEPS = 10;
+	static const uint16_t MAX_WAIT = 4032; // ms, largest Gas_wait_x value
+
+	BME680_HeaterSequencer();
+
+	/* Step 0..9: Res_heat_x value and heater wait in ms, steps are used in order from 0 */
+	void setStep(uint8_t step, uint8_t resHeat, uint16_t waitMs);
+	/* Number of steps of the profile (1..10), set by setStep to the highest step + 1 */
+	void setCount(uint8_t count);
+	/* Failures in a row before the wait grows, growth in percent (at least 1 ms), upper limit in ms */
+	void setAdaptation(uint8_t threshold, uint16_t growth, uint16_t maxWait = MAX_WAIT);
+
+	/* Write Res_heat_x and Gas_wait_x of all steps, start again at step 0 */
+	void configure(BME680_Base &dev);
+
+	/* Heater step (nb_conv) of the next measurement */
+	uint8_t current() const { return step; }
+	/* Gas_wait_x value of the next measurement, for BME680_Measurement::setGas */
+	uint8_t waitCode() const { return code[step]; }
+	/* Heater wait of a step in ms, as encoded */
+	uint32_t wait(uint8_t step) const;
+
+	/*
+	 * Count the gas result of the current step by its class, lengthen the wait of the
+	 * step if needed (writes Gas_wait_x) and advance to the next step. raw must hold a
+	 * measurement with gas of current(): a result whose gas_meas_index_0 is another step
+	 * is not counted, the step stays, and NOT_VALID is returned. Otherwise returns the
+	 * BME680_GasClass of the result.
+	 */
+	uint8_t record(BME680_Base &dev, const BME680_RawSample &raw);
+
+	const BME680_HeaterStepStats &stats(uint8_t step) const { return steps[step]; }
+	/* Clear the counters, the waits are kept */
+	void resetStats();
+
+private:
+	void extend(BME680_Base &dev, uint8_t step);
+
+	uint8_t resHeat[STEPS];
+	uint16_t waitMs[STEPS];
+	uint8_t code[STEPS];
+	BME680_HeaterStepStats steps[STEPS];
+	uint8_t count;
+	uint8_t step;
+	uint8_t threshold;
+	uint16_t growth;
+	uint16_t maxWait;
+};
+
+#endif
@@ -0,0 +1,32 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_IIR.cpp
+ */
+
+#include "BME680_IIR.hpp"
+
+uint8_t BME680_IIR::coefficient(uint8_t setting)
+{
+	static const uint8_t c[SETTINGS] = { 0, 1, 3, 7, 15, 31, 63, 127 };
+	return c[setting < SETTINGS ? setting : SETTINGS - 1];
+}
+
+void BME680_iirUpdate(uint64_t *state, uint64_t *primed, const uint64_t *shift,
+	const uint32_t *input, uint32_t *output, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint64_t x = (uint64_t)input[i] << BME680_IIR::FRACTION_BITS;
+		uint64_t old = state[i];
+		/* (old * (2^k - 1) + x) / 2^k, all terms unsigned */
+		uint64_t filtered = ((old << shift[i]) - old + x) >> shift[i];
+		uint64_t next = (filtered & primed[i]) | (x & ~primed[i]);
+		state[i] = next;
+		primed[i] = ~(uint64_t)0;
+		output[i] = (uint32_t)(next >> BME680_IIR::FRACTION_BITS);
+	}
+}
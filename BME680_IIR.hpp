@@ -0,0 +1,100 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_IIR.hpp
+ */
+
+#ifndef BME680_IIR_HPP
+#define BME680_IIR_HPP
+
+#include <cinttypes>
+
+/*
+ * Software emulation of the IIR filter selected by Config::filter.
+ * The chip filters temperature and pressure only:
+ *     data_filtered = (data_filtered_old * c + data_adc) / (c + 1)
+ * with c = 0, 1, 3, 7, 15, 31, 63, 127 for filter = 0..7. Since c + 1 = 2^filter
+ * the division is a shift, which makes the recursion cheap to run in fixed point
+ * for humidity and gas, or for temperature/pressure with the on-chip filter off.
+ */
+struct BME680_IIR
+{
+	/* Extra fractional bits kept in the filter state to avoid truncation drift */
+	static const uint8_t FRACTION_BITS = 8;
+	/* Number of Config::filter settings */
+	static const uint8_t SETTINGS = 8;
+
+	/* Filter coefficient c for a Config::filter setting (0..7) */
+	static uint8_t coefficient(uint8_t setting);
+};
+
+/*
+ * One filter pass over 'count' independent streams stored as structure of arrays.
+ * state:  filter memory in units of 2^-FRACTION_BITS
+ * primed: all ones once a lane has seen its first value, zero before
+ * shift:  Config::filter setting per lane
+ * The loop has no branches and only 64 bit add/sub/shift, so it is vectorized
+ * by the compiler (e.g. variable shifts of AVX2) when built with optimization.
+ */
+void BME680_iirUpdate(uint64_t *state, uint64_t *primed, const uint64_t *shift,
+	const uint32_t *input, uint32_t *output, uint32_t count);
+
+/*
+ * Bank of LANES filter streams, e.g. one lane per sensor and channel.
+ * The first value of a lane initializes the filter memory.
+ */
+template<uint32_t LANES>
+class BME680_IIRBank
+{
+public:
+	BME680_IIRBank()
+	{
+		for (uint32_t i = 0; i < LANES; i++)
+		{
+			state[i] = 0;
+			primed[i] = 0;
+			shift[i] = 0;
+		}
+	}
+
+	/* Select the Config::filter setting (0..7) of a lane */
+	void setFilter(uint32_t lane, uint8_t setting)
+	{
+		shift[lane] = setting < BME680_IIR::SETTINGS ? setting : BME680_IIR::SETTINGS - 1;
+	}
+
+	void setFilter(uint8_t setting)
+	{
+		for (uint32_t i = 0; i < LANES; i++)
+			setFilter(i, setting);
+	}
+
+	/* Forget the filter memory, the next value restarts the lane */
+	void reset(uint32_t lane)
+	{
+		state[lane] = 0;
+		primed[lane] = 0;
+	}
+
+	/* Filter one new value of every lane, input and output may be the same array */
+	void update(const uint32_t *input, uint32_t *output)
+	{
+		BME680_iirUpdate(state, primed, shift, input, output, LANES);
+	}
+
+	/* Current filter output of a lane */
+	uint32_t value(uint32_t lane) const
+	{
+		return (uint32_t)(state[lane] >> BME680_IIR::FRACTION_BITS);
+	}
+
+private:
+	uint64_t state[LANES];
+	uint64_t primed[LANES];
+	uint64_t shift[LANES];
+};
+
+#endif
@@ -0,0 +1,112 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_IncrementalCompensation.cpp
+ */
+
+#include "BME680_IncrementalCompensation.hpp"
+
+/* The cached results use the channel bits, the terms the bits above */
+#define BME680_CACHED(channel) (uint8_t)(1 << BME680_Channel::channel)
+
+BME680_IncrementalCompensation::BME680_IncrementalCompensation(const BME680_Calibration &calibration)
+	: computed(0), reused(0), termUpdates(0), cal(calibration), comp(calibration), cached(0),
+	adcT(0), resultT(0), adcP(0), resultP(0), adcH(0), resultH(0), adcG(0), rangeG(0), resultG(0)
+{
+}
+
+void BME680_IncrementalCompensation::reset()
+{
+	cached = 0;
+}
+
+int16_t BME680_IncrementalCompensation::temperature(uint32_t adc)
+{
+	if ((cached & BME680_CACHED(TEMPERATURE)) && adc == adcT)
+	{
+		reused++;
+		return resultT;
+	}
+	computed++;
+	resultT = comp.temperature(adc);
+	adcT = adc;
+	/* Everything but the gas resistance depends on t_fine */
+	cached = (uint8_t)((cached & BME680_CACHED(GAS)) | BME680_CACHED(TEMPERATURE));
+	return resultT;
+}
+
+uint32_t BME680_IncrementalCompensation::pressure(uint32_t adc)
+{
+	if ((cached & BME680_CACHED(PRESSURE)) && adc == adcP)
+	{
+		reused++;
+		return resultP;
+	}
+	if (!(cached & PRESSURE_TERMS))
+	{
+		termUpdates++;
+		pTerms.setup(cal, comp.tFine());
+		cached |= PRESSURE_TERMS;
+	}
+	computed++;
+	resultP = pTerms.pressure(cal, adc);
+	adcP = adc;
+	cached |= BME680_CACHED(PRESSURE);
+	return resultP;
+}
+
+uint32_t BME680_IncrementalCompensation::humidity(uint16_t adc)
+{
+	if ((cached & BME680_CACHED(HUMIDITY)) && adc == adcH)
+	{
+		reused++;
+		return resultH;
+	}
+	if (!(cached & HUMIDITY_TERMS))
+	{
+		termUpdates++;
+		hTerms.setup(cal, comp.tFine());
+		cached |= HUMIDITY_TERMS;
+	}
+	computed++;
+	resultH = hTerms.humidity(adc);
+	adcH = adc;
+	cached |= BME680_CACHED(HUMIDITY);
+	return resultH;
+}
+
+uint32_t BME680_IncrementalCompensation::gasResistance(uint16_t adc, uint8_t range)
+{
+	range &= 0x0f;
+	if ((cached & BME680_CACHED(GAS)) && adc == adcG && range == rangeG)
+	{
+		reused++;
+		return resultG;
+	}
+	computed++;
+	resultG = comp.gasResistance(adc, range);
+	adcG = adc;
+	rangeG = range;
+	cached |= BME680_CACHED(GAS);
+	return resultG;
+}
+
+uint8_t BME680_IncrementalCompensation::compensate(const BME680_RawSample &raw, BME680_Sample &sample)
+{
+	sample.valid = 0;
+	if (raw.channels & (1 << BME680_Channel::TEMPERATURE))
+		sample.set(BME680_Channel::TEMPERATURE, temperature(raw.temperature) / 100.0);
+	if (comp.hasTemperature())
+	{
+		if (raw.channels & (1 << BME680_Channel::PRESSURE))
+			sample.set(BME680_Channel::PRESSURE, pressure(raw.pressure));
+		if (raw.channels & (1 << BME680_Channel::HUMIDITY))
+			sample.set(BME680_Channel::HUMIDITY, humidity(raw.humidity) / 1000.0);
+	}
+	if (raw.channels & (1 << BME680_Channel::GAS))
+		sample.set(BME680_Channel::GAS, gasResistance(raw.gas, raw.gasRange()));
+	return sample.valid;
+}
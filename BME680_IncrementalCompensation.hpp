@@ -0,0 +1,75 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_IncrementalCompensation.hpp
+ */
+
+#ifndef BME680_INCREMENTALCOMPENSATION_HPP
+#define BME680_INCREMENTALCOMPENSATION_HPP
+
+#include <cinttypes>
+#include "BME680_Calibration.hpp"
+#include "BME680_Compensation.hpp"
+#include "BME680_Measurement.hpp"
+#include "BME680_Sample.hpp"
+
+/*
+ * Integer compensation with the same results as BME680_Compensation that only recomputes
+ * what changed since the previous sample. The t_fine dependent terms of pressure and
+ * humidity are kept for the last raw temperature and rebuilt when it changes, and every
+ * channel keeps its last raw value and result. A slowly changing indoor signal mostly
+ * repeats its raw values, so most samples reduce to comparisons.
+ */
+class BME680_IncrementalCompensation
+{
+public:
+	BME680_IncrementalCompensation(const BME680_Calibration &cal);
+
+	/* Same as BME680_Compensation::compensate */
+	uint8_t compensate(const BME680_RawSample &raw, BME680_Sample &sample);
+
+	/* Temperature in 0.01 degree Celsius, updates t_fine */
+	int16_t temperature(uint32_t adc);
+	/* Pressure in Pa, needs a temperature first */
+	uint32_t pressure(uint32_t adc);
+	/* Humidity in 0.001 % relative humidity, needs a temperature first */
+	uint32_t humidity(uint16_t adc);
+	/* Gas resistance in Ohm */
+	uint32_t gasResistance(uint16_t adc, uint8_t range);
+
+	bool hasTemperature() const { return comp.hasTemperature(); }
+
+	/* Drop all cached terms and results, e.g. after the calibration was read again */
+	void reset();
+
+	/* Channel results computed / taken from the cache, and t_fine term updates */
+	uint32_t computed;
+	uint32_t reused;
+	uint32_t termUpdates;
+
+private:
+	const BME680_Calibration &cal;
+	BME680_Compensation comp;
+
+	/* Bit per cached item, cleared by a new t_fine (all but TEMPERATURE and GAS) */
+	uint8_t cached;
+	static const uint8_t PRESSURE_TERMS = 1 << 4;
+	static const uint8_t HUMIDITY_TERMS = 1 << 5;
+
+	uint32_t adcT;
+	int16_t resultT;
+	BME680_PressureTerms pTerms;
+	uint32_t adcP;
+	uint32_t resultP;
+	BME680_HumidityTerms hTerms;
+	uint16_t adcH;
+	uint32_t resultH;
+	uint16_t adcG;
+	uint8_t rangeG;
+	uint32_t resultG;
+};
+
+#endif
@@ -0,0 +1,192 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Measurement.cpp
+ */
+
+#include <cstring>
+#include "BME680.hpp"
+#include "BME680_Measurement.hpp"
+#include "BME680_Timing.hpp"
+
+void BME680_decodeTPH(const uint8_t *data, BME680_RawSample &raw)
+{
+	const uint8_t *p = data + (BME680_Base::press_msb::__address - BME680_DataBlock::FIRST);
+	raw.status = data[0];
+	raw.pressure = ((uint32_t)p[0] << 12) | ((uint32_t)p[1] << 4) | (p[2] >> 4);
+	raw.temperature = ((uint32_t)p[3] << 12) | ((uint32_t)p[4] << 4) | (p[5] >> 4);
+	raw.humidity = (uint16_t)((p[6] << 8) | p[7]);
+	raw.channels &= (uint8_t)~((1 << BME680_Channel::TEMPERATURE) | (1 << BME680_Channel::PRESSURE) | (1 << BME680_Channel::HUMIDITY));
+	if (raw.temperature != BME680_RawSample::SKIPPED_TP)
+		raw.channels |= 1 << BME680_Channel::TEMPERATURE;
+	if (raw.pressure != BME680_RawSample::SKIPPED_TP)
+		raw.channels |= 1 << BME680_Channel::PRESSURE;
+	if (raw.humidity != BME680_RawSample::SKIPPED_H)
+		raw.channels |= 1 << BME680_Channel::HUMIDITY;
+}
+
+void BME680_decodeGas(const uint8_t *data, BME680_RawSample &raw)
+{
+	raw.gas = (uint16_t)((data[0] << 2) | (data[1] >> 6));
+	raw.gasStatus = data[1] & (uint8_t)~BME680_Base::gas_r_lsb::gas_r::mask;
+	if (BME680_classifyGas(raw.gasStatus) == BME680_GasClass::VALID)
+		raw.channels |= 1 << BME680_Channel::GAS;
+	else
+		raw.channels &= (uint8_t)~(1 << BME680_Channel::GAS);
+}
+
+BME680_Measurement::BME680_Measurement(BME680_Base &device)
+	: dev(device), step(0), gasWait(0), mode(BME680_Mode::TPHG), starts(0), pending(false), started(false),
+	lastMode(0xff)
+{
+	osrs[0] = osrs[1] = osrs[2] = BME680_Base::Ctrl_meas::osrs_t::X1;
+	invalidate();
+}
+
+void BME680_Measurement::invalidate()
+{
+	ctrlHum = ctrlGas0 = ctrlGas1 = -1;
+}
+
+void BME680_Measurement::setOversampling(uint8_t osrs_t, uint8_t osrs_p, uint8_t osrs_h)
+{
+	osrs[0] = osrs_t;
+	osrs[1] = osrs_p;
+	osrs[2] = osrs_h;
+}
+
+void BME680_Measurement::setGas(uint8_t heaterStep, uint8_t gasWaitValue)
+{
+	step = heaterStep;
+	gasWait = gasWaitValue;
+}
+
+uint32_t BME680_Measurement::duration(uint8_t m) const
+{
+	if (m == BME680_Mode::GAS)
+		return BME680_Timing::tphg(0, 0, 0, true) + BME680_Timing::gasWait(gasWait) * 1000;
+	if (m == BME680_Mode::TPH)
+		return BME680_Timing::tphg(osrs[0], osrs[1], osrs[2], false);
+	return BME680_Timing::tphg(osrs[0], osrs[1], osrs[2], true) + BME680_Timing::gasWait(gasWait) * 1000;
+}
+
+void BME680_Measurement::set(uint16_t address, uint8_t value, int16_t &cache)
+{
+	if (cache != value)
+	{
+		dev.write(address, value, 8);
+		cache = value;
+	}
+}
+
+uint32_t BME680_Measurement::start(uint8_t m)
+{
+	typedef BME680_Base B;
+	mode = m;
+	starts++;
+	bool tph = m != BME680_Mode::GAS;
+	bool gas = m != BME680_Mode::TPH;
+	uint8_t t = tph ? osrs[0] : B::Ctrl_meas::osrs_t::SKIPPED;
+	uint8_t p = tph ? osrs[1] : B::Ctrl_meas::osrs_p::SKIPPED;
+	uint8_t h = tph ? osrs[2] : B::Ctrl_hum::osrs_h::SKIPPED;
+
+	/* Ctrl_hum also holds spi_3w_int_en: read it once, then keep the other bits from the cache */
+	if (ctrlHum < 0)
+		ctrlHum = dev.getCtrl_hum();
+	set(B::Ctrl_hum::__address, (uint8_t)((ctrlHum & ~B::Ctrl_hum::osrs_h::mask) | (h & B::Ctrl_hum::osrs_h::mask)), ctrlHum);
+	set(B::Ctrl_gas_0::__address, gas ? 0 : B::Ctrl_gas_0::heat_off::mask, ctrlGas0);
+	set(B::Ctrl_gas_1::__address, gas ? (uint8_t)(B::Ctrl_gas_1::run_gas::mask | (step & B::Ctrl_gas_1::nb_conv::mask)) : 0, ctrlGas1);
+	/* Ctrl_meas last: it applies Ctrl_hum and starts the conversion */
+	dev.setCtrl_meas((uint8_t)(((t << 5) & B::Ctrl_meas::osrs_t::mask) | ((p << 2) & B::Ctrl_meas::osrs_p::mask)
+		| B::Ctrl_meas::mode::FORCED));
+	/*
+	 * A lost FORCED write leaves the last result in the data registers with new_data_0 set.
+	 * A running conversion (or cleared new_data_0) right after the write proves the start;
+	 * otherwise the conversion may as well have finished already, fetch decides by the data.
+	 */
+	uint8_t status = dev.getmeas_status_0();
+	started = !(status & B::meas_status_0::new_data_0::mask)
+		|| (status & (B::meas_status_0::measuring::mask | B::meas_status_0::gas_measuring::mask));
+	pending = true;
+	return duration(m);
+}
+
+/* Check the status byte read together with (or right before) the data */
+static uint8_t checkStatus(uint8_t status, bool gas, uint8_t step)
+{
+	typedef BME680_Base::meas_status_0 S;
+	if (!(status & S::new_data_0::mask))
+		return BME680_ReadStatus::NOT_READY;
+	/* A conversion is running although the result of ours is there: someone started another one */
+	if (status & (S::measuring::mask | S::gas_measuring::mask))
+		return BME680_ReadStatus::TORN;
+	if (gas && (status & S::gas_meas_index_0::mask) != (step & S::gas_meas_index_0::mask))
+		return BME680_ReadStatus::TORN;
+	return BME680_ReadStatus::OK;
+}
+
+uint8_t BME680_Measurement::fetch(BME680_RawSample &raw)
+{
+	uint8_t data[BME680_DataBlock::SIZE];
+	if (!pending)
+		return BME680_ReadStatus::REPEATED;
+
+	if (mode == BME680_Mode::GAS)
+	{
+		/* The gas registers are not adjacent to meas_status_0, a 15 byte burst would read all TPH data */
+		uint8_t status = dev.getmeas_status_0();
+		uint8_t result = checkStatus(status, true, step);
+		if (result != BME680_ReadStatus::OK)
+			return result;
+		/* Nothing can update the registers between the two transfers: no conversion is running */
+		dev.readBurst(BME680_DataBlock::GAS_FIRST, data, BME680_DataBlock::GAS_SIZE);
+		pending = false;
+		if (repeated(data, BME680_DataBlock::GAS_SIZE))
+			return BME680_ReadStatus::REPEATED;
+		raw = BME680_RawSample();
+		raw.status = status;
+		raw.registers[0] = status;
+		memcpy(raw.registers + (BME680_DataBlock::GAS_FIRST - BME680_DataBlock::FIRST), data, BME680_DataBlock::GAS_SIZE);
+		BME680_decodeGas(data, raw);
+		return result;
+	}
+
+	uint16_t size = mode == BME680_Mode::TPH ? BME680_DataBlock::TPH_SIZE : BME680_DataBlock::SIZE;
+	dev.readBurst(BME680_DataBlock::FIRST, data, size);
+	/* The device shadows the data registers for the duration of a burst, the status byte describes them */
+	uint8_t result = checkStatus(data[0], mode == BME680_Mode::TPHG, step);
+	if (result != BME680_ReadStatus::OK)
+		return result;
+	pending = false;
+	if (repeated(data, size))
+		return BME680_ReadStatus::REPEATED;
+	raw = BME680_RawSample();
+	memcpy(raw.registers, data, size);
+	BME680_decodeTPH(data, raw);
+	if (mode == BME680_Mode::TPHG)
+		BME680_decodeGas(data + (BME680_DataBlock::GAS_FIRST - BME680_DataBlock::FIRST), raw);
+	return result;
+}
+
+bool BME680_Measurement::repeated(const uint8_t *data, uint16_t size)
+{
+	/* Without a proven start, the same bytes as the last delivered result are that result */
+	bool same = !started && lastMode == mode && !memcmp(data, last, size);
+	memcpy(last, data, size);
+	lastMode = mode;
+	return same;
+}
+
+uint8_t BME680_Measurement::fetch(BME680_RawSample &raw, BME680_Clock &clock, uint8_t attempts, uint32_t intervalUs)
+{
+	uint8_t result = fetch(raw);
+	for (uint8_t i = 1; i < attempts && (result == BME680_ReadStatus::NOT_READY || result == BME680_ReadStatus::TORN); i++)
+	{
+		clock.sleep(intervalUs);
+		result = fetch(raw);
+	}
+	return result;
+}
@@ -0,0 +1,172 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Measurement.hpp
+ */
+
+#ifndef BME680_MEASUREMENT_HPP
+#define BME680_MEASUREMENT_HPP
+
+#include <cinttypes>
+#include "BME680_Core.hpp"
+#include "BME680_DataRegisters.hpp"
+#include "BME680_StatusRegisters.hpp"
+#include "BME680_Clock.hpp"
+#include "BME680_Sample.hpp"
+
+/* Layout of the data registers, meas_status_0 (29) to gas_r_lsb (43) */
+struct BME680_DataBlock
+{
+	static const uint16_t FIRST = 29; // meas_status_0
+	static const uint16_t TPH_LAST = 38; // hum_lsb
+	static const uint16_t GAS_FIRST = 42; // gas_r_msb
+	static const uint16_t LAST = 43; // gas_r_lsb
+	static const uint16_t SIZE = LAST - FIRST + 1;
+	static const uint16_t TPH_SIZE = TPH_LAST - FIRST + 1;
+	static const uint16_t GAS_SIZE = LAST - GAS_FIRST + 1;
+};
+
+/* Uncompensated result of one measurement */
+struct BME680_RawSample
+{
+	uint8_t status; // meas_status_0
+	uint32_t temperature; // 20 bit ADC value
+	uint32_t pressure; // 20 bit ADC value
+	uint16_t humidity; // 16 bit ADC value
+	uint16_t gas; // 10 bit ADC value
+	uint8_t gasStatus; // gas_r_lsb: gas_valid_r, heat_stab_r and gas_range_r
+	uint8_t channels; // bit (1 << BME680_Channel::x) is set for each channel that was read
+	uint8_t registers[BME680_DataBlock::SIZE]; // data block as read by BME680_Measurement::fetch, 0 where not read
+
+	/* Values of the result registers when a channel was skipped (osrs_x = SKIPPED) */
+	static const uint32_t SKIPPED_TP = 0x80000;
+	static const uint16_t SKIPPED_H = 0x8000;
+
+	BME680_RawSample() : status(0), temperature(0), pressure(0), humidity(0), gas(0), gasStatus(0), channels(0)
+	{
+		for (uint16_t i = 0; i < BME680_DataBlock::SIZE; i++)
+			registers[i] = 0;
+	}
+
+	uint8_t gasRange() const { return gasStatus & BME680_DataRegisters::gas_r_lsb::gas_range_r::mask; }
+	uint8_t gasIndex() const { return status & BME680_StatusRegisters::meas_status_0::gas_meas_index_0::mask; }
+	uint8_t gasClass() const;
+};
+
+/* Classification of a gas result by the status bits of gas_r_lsb */
+struct BME680_GasClass
+{
+	static const uint8_t VALID = 0; // gas_valid_r and heat_stab_r set
+	static const uint8_t NOT_VALID = 1; // gas_valid_r = 0: no conversion, or a result already read
+	static const uint8_t NOT_STABLE = 2; // heat_stab_r = 0: the heater did not reach its target in Gas_wait_x
+};
+
+/* Classify a gas_r_lsb value (only the status bits are looked at) */
+inline uint8_t BME680_classifyGas(uint8_t gasStatus)
+{
+	if (!(gasStatus & BME680_DataRegisters::gas_r_lsb::gas_valid_r::mask))
+		return BME680_GasClass::NOT_VALID;
+	if (!(gasStatus & BME680_DataRegisters::gas_r_lsb::heat_stab_r::mask))
+		return BME680_GasClass::NOT_STABLE;
+	return BME680_GasClass::VALID;
+}
+
+inline uint8_t BME680_RawSample::gasClass() const { return BME680_classifyGas(gasStatus); }
+
+/*
+ * Decode meas_status_0 .. hum_lsb (10 bytes starting at register 29).
+ * T, P and H are flagged in raw.channels unless they hold the skipped-channel value.
+ * A converted value can in rare cases equal 0x80000 as well and is then dropped too.
+ */
+void BME680_decodeTPH(const uint8_t *data, BME680_RawSample &raw);
+/*
+ * Decode gas_r_msb and gas_r_lsb (2 bytes starting at register 42). Gas is flagged only for
+ * BME680_GasClass::VALID, so an invalid or unstable result is never compensated; its status
+ * stays in raw.gasStatus for BME680_HeaterSequencer.
+ */
+void BME680_decodeGas(const uint8_t *data, BME680_RawSample &raw);
+
+/* Measurement modes */
+struct BME680_Mode
+{
+	static const uint8_t TPHG = 0; // all channels, one 15 byte burst
+	static const uint8_t TPH = 1; // no gas conversion, heater off, one 10 byte burst (29..38)
+	static const uint8_t GAS = 2; // T/P/H skipped, status byte and a 2 byte burst (42..43)
+};
+
+/* Result of BME680_Measurement::fetch */
+struct BME680_ReadStatus
+{
+	static const uint8_t OK = 0;
+	static const uint8_t NOT_READY = 1; // new_data_0 not set yet, read again later
+	static const uint8_t TORN = 2; // the data changed during the transfer or belongs to another heater step
+	static const uint8_t REPEATED = 3; // the result of the last start() was already delivered, or the device did not start
+};
+
+/*
+ * Forced mode measurement of one device.
+ * Unneeded channels are configured with osrs_x = SKIPPED and the heater is switched off
+ * when no gas is measured, so each mode pays only for its own conversions and reads.
+ * Registers are only written when they differ from what this object wrote last.
+ * Ctrl_hum is read once before its first write, so spi_3w_int_en keeps its setting.
+ */
+class BME680_Measurement
+{
+public:
+	BME680_Measurement(BME680_Base &dev);
+
+	/* osrs_x codes used for the channels a mode measures */
+	void setOversampling(uint8_t osrs_t, uint8_t osrs_p, uint8_t osrs_h);
+	/* Heater step (nb_conv) and its Gas_wait_x register value, to compute the duration */
+	void setGas(uint8_t step, uint8_t gasWait);
+
+	/* Conversion time of a mode in us */
+	uint32_t duration(uint8_t mode) const;
+
+	/* Start a measurement, returns its conversion time in us. The status is read back to see the conversion start */
+	uint32_t start(uint8_t mode);
+	/*
+	 * Read and validate the result of the last started measurement, a BME680_ReadStatus.
+	 * The status byte comes with the data in the same burst, so no extra reads are needed:
+	 * new_data_0 must be set and measuring/gas_measuring clear (otherwise a conversion is
+	 * updating the registers), gas_meas_index_0 must be the configured heater step, and
+	 * each start() delivers at most one sample. If start() did not see the conversion running
+	 * (lost FORCED write, or one that had already finished), a result with the same data bytes
+	 * as the last delivered one is REPEATED. raw is only written if OK.
+	 */
+	uint8_t fetch(BME680_RawSample &raw);
+	/* Read the result of the last started measurement, false while it is not available */
+	bool read(BME680_RawSample &raw) { return fetch(raw) == BME680_ReadStatus::OK; }
+	/* fetch, repeated after intervalUs up to 'attempts' times while NOT_READY or TORN */
+	uint8_t fetch(BME680_RawSample &raw, BME680_Clock &clock, uint8_t attempts, uint32_t intervalUs);
+
+	/* Number of measurements started */
+	uint32_t sequence() const { return starts; }
+
+	/* Forget what was written, e.g. after a reset of the device or a change of spi_3w_int_en */
+	void invalidate();
+
+private:
+	void set(uint16_t address, uint8_t value, int16_t &cache);
+	bool repeated(const uint8_t *data, uint16_t size);
+
+	BME680_Base &dev;
+	uint8_t osrs[3];
+	uint8_t step;
+	uint8_t gasWait;
+	uint8_t mode;
+	uint32_t starts;
+	bool pending; // a started measurement was not delivered yet
+	bool started; // the conversion was seen running (or new_data_0 cleared) right after start()
+	uint8_t last[BME680_DataBlock::SIZE]; // data bytes of the last delivered result
+	uint8_t lastMode; // mode of that result, 0xff if none
+
+	int16_t ctrlHum; // last written register values, -1 if unknown
+	int16_t ctrlGas0;
+	int16_t ctrlGas1;
+};
+
+#endif
@@ -0,0 +1,332 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Metrics.cpp
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include "BME680_Clock.hpp"
+#include "BME680_Metrics.hpp"
+
+/* Fixed-width field of a value: total width including sign and decimal point */
+struct Format
+{
+	uint8_t width;
+	uint8_t decimals;
+	bool sign;
+};
+
+/* Indexed by the field enumeration of BME680_Exporter */
+static const Format formats[] = {
+	{10, 2, true}, // temperature: +000021.37
+	{9, 0, false}, // pressure: 000101325
+	{7, 3, false}, // humidity: 050.123
+	{10, 0, false}, // gas
+	{12, 3, false}, {12, 3, false}, {12, 3, false}, {12, 3, false}, // ages
+	{1, 0, false}, {1, 0, false}, // gas_valid, heat_stab
+	{15, 0, false}, {15, 0, false}, {15, 0, false}, // counters
+};
+
+/* Metric family with one sample per sensor, or one per channel for the ages */
+struct Family
+{
+	const char *name;
+	const char *type;
+	const char *unit;
+	const char *help;
+	uint8_t field;
+	uint8_t lines;
+};
+
+static const Family families[] = {
+	{"bme680_temperature_celsius", "gauge", "celsius", "Compensated temperature", 0, 1},
+	{"bme680_pressure_pascals", "gauge", "pascals", "Compensated pressure", 1, 1},
+	{"bme680_humidity_percent", "gauge", "percent", "Compensated relative humidity", 2, 1},
+	{"bme680_gas_resistance_ohms", "gauge", "ohms", "Compensated gas resistance", 3, 1},
+	{"bme680_sample_age_seconds", "gauge", "seconds", "Time since the last valid value of a channel", 4, 4},
+	{"bme680_gas_valid", "gauge", 0, "gas_valid_r of the last sample", 8, 1},
+	{"bme680_heat_stable", "gauge", 0, "heat_stab_r of the last sample", 9, 1},
+	{"bme680_samples", "counter", 0, "Samples received", 10, 1},
+	{"bme680_bus_transactions", "counter", 0, "Bus transactions", 11, 1},
+	{"bme680_bus_errors", "counter", 0, "Failed bus transactions", 12, 1},
+};
+
+static const char *channels[] = {"temperature", "pressure", "humidity", "gas"};
+
+BME680_Exporter::BME680_Exporter(char *text, size_t bytes)
+	: buffer(text), size(bytes), used(0), count(0)
+{
+}
+
+int BME680_Exporter::addSensor(const char *name, const BME680_BusStats *bus)
+{
+	if (count == MAX_SENSORS)
+		return -1;
+	Sensor &s = sensors[count];
+	s.name = name;
+	s.bus = bus;
+	for (uint8_t f = 0; f < FIELDS; f++)
+	{
+		s.value[f] = 0;
+		s.shown[f] = NAN;
+		s.span[f] = 0;
+	}
+	s.time[0] = s.time[1] = s.time[2] = s.time[3] = 0;
+	s.generation = 0;
+	return count++;
+}
+
+bool BME680_Exporter::append(const char *s)
+{
+	size_t n = strlen(s);
+	if (used + n >= size)
+		return false;
+	memcpy(buffer + used, s, n);
+	used += n;
+	return true;
+}
+
+bool BME680_Exporter::label(const char *s)
+{
+	/* Label values escape backslash, double quote and line feed */
+	for (; *s; s++)
+	{
+		const char *e = *s == '\\' ? "\\\\" : *s == '"' ? "\\\"" : *s == '\n' ? "\\n" : 0;
+		char c[2] = {*s, 0};
+		if (!append(e ? e : c))
+			return false;
+	}
+	return true;
+}
+
+bool BME680_Exporter::build()
+{
+	used = 0;
+	bool ok = true;
+	for (size_t i = 0; i < sizeof(families) / sizeof(families[0]); i++)
+	{
+		const Family &family = families[i];
+		bool counter = strcmp(family.type, "counter") == 0;
+		ok = ok && append("# TYPE ") && append(family.name) && append(" ") && append(family.type) && append("\n");
+		if (family.unit)
+			ok = ok && append("# UNIT ") && append(family.name) && append(" ") && append(family.unit) && append("\n");
+		ok = ok && append("# HELP ") && append(family.name) && append(" ") && append(family.help) && append("\n");
+		for (uint8_t s = 0; s < count; s++)
+		{
+			for (uint8_t line = 0; line < family.lines; line++)
+			{
+				uint8_t field = (uint8_t)(family.field + line);
+				ok = ok && append(family.name) && append(counter ? "_total" : "") && append("{sensor=\"") && label(sensors[s].name);
+				if (family.lines > 1)
+					ok = ok && append("\",channel=\"") && append(channels[line]);
+				ok = ok && append("\"} ");
+				if (!ok || used + formats[field].width + 1 >= size)
+					return false;
+				sensors[s].span[field] = (uint32_t)used;
+				sensors[s].shown[field] = NAN;
+				memset(buffer + used, '0', formats[field].width);
+				used += formats[field].width;
+				ok = ok && append("\n");
+			}
+		}
+	}
+	ok = ok && append("# EOF\n");
+	if (!ok)
+		return false;
+	buffer[used] = 0;
+	return true;
+}
+
+void BME680_Exporter::update(uint8_t sensor, const bme680_record &record)
+{
+	if (sensor >= count)
+		return;
+	Sensor &s = sensors[sensor];
+	double values[4] = {record.temperature / 100.0, (double)record.pressure, record.humidity / 1000.0,
+		(double)record.gas_resistance};
+	for (uint8_t c = 0; c < 4; c++)
+	{
+		if (record.valid & (1 << c))
+		{
+			s.value[TEMPERATURE + c] = values[c];
+			s.time[c] = record.timestamp_us;
+		}
+	}
+	s.value[GAS_VALID] = (record.flags & BME680_RECORD_GAS_VALID) ? 1 : 0;
+	s.value[HEAT_STAB] = (record.flags & BME680_RECORD_HEAT_STAB) ? 1 : 0;
+	s.value[SAMPLES] += 1;
+}
+
+void BME680_Exporter::update(const BME680_ShmTable &table)
+{
+	for (uint8_t i = 0; i < count && i < table.sensors(); i++)
+	{
+		if (table.generation(i) == sensors[i].generation)
+			continue;
+		bme680_record record;
+		uint32_t generation = table.read(i, record);
+		update(i, record);
+		/* Also count the records published in between, which were overwritten */
+		sensors[i].value[SAMPLES] += (double)(uint32_t)(generation - sensors[i].generation - 1);
+		sensors[i].generation = generation;
+	}
+}
+
+void BME680_Exporter::put(uint8_t sensor, uint8_t field)
+{
+	Sensor &s = sensors[sensor];
+	double v = s.value[field];
+	if (v == s.shown[field])
+		return;
+	const Format &f = formats[field];
+	/* Largest value that fits: all digits 9 */
+	int digits = f.width - (f.decimals ? f.decimals + 1 : 0) - (f.sign ? 1 : 0);
+	double max = std::pow(10.0, digits) - std::pow(10.0, -f.decimals);
+	double shown = v > max ? max : v < (f.sign ? -max : 0.0) ? (f.sign ? -max : 0.0) : v;
+
+	char text[40];
+	int n = snprintf(text, sizeof(text), f.sign ? "%+0*.*f" : "%0*.*f", f.width, f.decimals, shown);
+	/* Rounding up to the next power of ten can still add a digit */
+	if (n != f.width)
+		n = snprintf(text, sizeof(text), f.sign ? "%+0*.*f" : "%0*.*f", f.width, f.decimals, shown > 0 ? max : -max);
+	if (n == f.width)
+		memcpy(buffer + s.span[field], text, f.width);
+	s.shown[field] = v;
+}
+
+void BME680_Exporter::render(uint64_t now)
+{
+	for (uint8_t i = 0; i < count; i++)
+	{
+		Sensor &s = sensors[i];
+		for (uint8_t c = 0; c < 4; c++)
+			s.value[AGE_T + c] = now > s.time[c] ? (now - s.time[c]) / 1e6 : 0.0;
+		if (s.bus)
+		{
+			s.value[TRANSACTIONS] = (double)s.bus->transactions;
+			s.value[ERRORS] = (double)s.bus->errors;
+		}
+		for (uint8_t f = 0; f < FIELDS; f++)
+			put(i, f);
+	}
+}
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                            HTTP SERVER                                            *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+BME680_MetricsServer::BME680_MetricsServer(BME680_Exporter &e)
+	: exporter(e), sock(-1)
+{
+}
+
+BME680_MetricsServer::~BME680_MetricsServer()
+{
+	close();
+}
+
+bool BME680_MetricsServer::listen(uint16_t port, const char *address)
+{
+	close();
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(port);
+	if (inet_pton(AF_INET, address, &addr.sin_addr) != 1)
+		return false;
+	sock = socket(AF_INET, SOCK_STREAM, 0);
+	if (sock < 0)
+		return false;
+	int one = 1;
+	setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+	if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0 || ::listen(sock, 4) != 0)
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+void BME680_MetricsServer::close()
+{
+	if (sock >= 0)
+		::close(sock);
+	sock = -1;
+}
+
+/* Send all bytes, false on error */
+static bool sendAll(int fd, const char *data, size_t length)
+{
+	while (length)
+	{
+		ssize_t n = send(fd, data, length, MSG_NOSIGNAL);
+		if (n <= 0)
+			return false;
+		data += n;
+		length -= (size_t)n;
+	}
+	return true;
+}
+
+bool BME680_MetricsServer::poll(int timeoutMs, uint64_t now)
+{
+	struct pollfd pfd;
+	pfd.fd = sock;
+	pfd.events = POLLIN;
+	if (sock < 0 || ::poll(&pfd, 1, timeoutMs) <= 0)
+		return false;
+	int fd = accept(sock, 0, 0);
+	if (fd < 0)
+		return false;
+
+	/* Read the request header, only the method matters */
+	char request[1024];
+	size_t length = 0;
+	pfd.fd = fd;
+	BME680_SystemClock clock;
+	uint64_t end = clock.micros() + REQUEST_TIMEOUT_MS * 1000;
+	for (uint64_t t = clock.micros(); length < sizeof(request) - 1 && t < end; t = clock.micros())
+	{
+		if (::poll(&pfd, 1, (int)((end - t + 999) / 1000)) <= 0)
+			break;
+		ssize_t n = recv(fd, request + length, sizeof(request) - 1 - length, 0);
+		if (n <= 0)
+			break;
+		length += (size_t)n;
+		request[length] = 0;
+		if (strstr(request, "\r\n\r\n"))
+			break;
+	}
+	request[length] = 0;
+
+	char header[160];
+	bool get = strncmp(request, "GET ", 4) == 0;
+	if (get)
+	{
+		exporter.render(now);
+		int n = snprintf(header, sizeof(header), "HTTP/1.0 200 OK\r\n"
+			"Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"
+			"Content-Length: %lu\r\n\r\n", (unsigned long)exporter.length());
+		if (sendAll(fd, header, (size_t)n))
+			sendAll(fd, exporter.text(), exporter.length());
+	}
+	else
+	{
+		const char *response = "HTTP/1.0 405 Method Not Allowed\r\nContent-Length: 0\r\n\r\n";
+		sendAll(fd, response, strlen(response));
+	}
+	::close(fd);
+	return get;
+}
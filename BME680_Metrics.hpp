@@ -0,0 +1,116 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Metrics.hpp
+ */
+
+#ifndef BME680_METRICS_HPP
+#define BME680_METRICS_HPP
+
+#include <cinttypes>
+#include <cstddef>
+#include "BME680_BusStats.hpp"
+#include "BME680_Shm.hpp"
+#include "bme680_record.h"
+
+/*
+ * OpenMetrics text exposition of the sensors, rendered into a buffer given by the caller.
+ * build() writes the complete text once; every number gets a fixed-width, zero-padded
+ * field (e.g. "+000021.37"), so render() only overwrites the fields whose value changed
+ * and the text never moves. No heap allocation, cost per scrape O(sensors).
+ * A value that does not fit its field is clamped to the largest one that does.
+ * Invalid channels keep their last value; their sample age shows how old it is.
+ */
+class BME680_Exporter
+{
+public:
+	static const uint8_t MAX_SENSORS = 16;
+
+	BME680_Exporter(char *buffer, size_t size);
+
+	/*
+	 * Sensor label value and optional bus counters, before build(). Returns the index or -1.
+	 * bme680_bus_errors stays 0 unless the counters come from a BME680_ResilientTransport.
+	 */
+	int addSensor(const char *name, const BME680_BusStats *bus = 0);
+	/* Write the text, false if the buffer is too small */
+	bool build();
+
+	/* New record of a sensor (timestamp_us on the clock passed to render) */
+	void update(uint8_t sensor, const bme680_record &record);
+	/* Records published to shared memory since the last call, sensor index = table index */
+	void update(const BME680_ShmTable &table);
+
+	/* Refresh the changed fields for a scrape at time now (us) */
+	void render(uint64_t now);
+
+	const char *text() const { return buffer; }
+	size_t length() const { return used; }
+
+private:
+	/* Numeric fields of a sensor */
+	enum
+	{
+		TEMPERATURE, PRESSURE, HUMIDITY, GAS,
+		AGE_T, AGE_P, AGE_H, AGE_G,
+		GAS_VALID, HEAT_STAB,
+		SAMPLES, TRANSACTIONS, ERRORS,
+		FIELDS
+	};
+
+	struct Sensor
+	{
+		const char *name;
+		const BME680_BusStats *bus;
+		double value[FIELDS]; // current value
+		double shown[FIELDS]; // value in the text
+		uint32_t span[FIELDS]; // offset of the field in the text
+		uint64_t time[4]; // timestamp of the last valid value of each channel
+		uint32_t generation; // of the shared memory entry
+	};
+
+	bool append(const char *s);
+	bool label(const char *s);
+	void put(uint8_t sensor, uint8_t field);
+
+	char *buffer;
+	size_t size;
+	size_t used;
+	Sensor sensors[MAX_SENSORS];
+	uint8_t count;
+};
+
+/*
+ * Minimal HTTP/1.0 server for scrapes: every GET is answered with the exporter text.
+ * One connection at a time, closed after the response. A client has REQUEST_TIMEOUT_MS
+ * in total to send its request header, so a slow or silent one cannot hold up the
+ * loop that calls poll() for longer.
+ */
+class BME680_MetricsServer
+{
+public:
+	static const int REQUEST_TIMEOUT_MS = 200;
+
+	BME680_MetricsServer(BME680_Exporter &exporter);
+	~BME680_MetricsServer();
+
+	/* Listen on a TCP port of an IPv4 address, default loopback only */
+	bool listen(uint16_t port, const char *address = "127.0.0.1");
+	void close();
+	/* Serve at most one scrape, waiting up to timeoutMs. 'now' is passed to render() */
+	bool poll(int timeoutMs, uint64_t now);
+
+	int fd() const { return sock; }
+
+private:
+	BME680_MetricsServer(const BME680_MetricsServer &);
+	BME680_MetricsServer &operator=(const BME680_MetricsServer &);
+
+	BME680_Exporter &exporter;
+	int sock;
+};
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Oversampling.cpp
+ */
+
+#include <cmath>
+#include "BME680.hpp"
+#include "BME680_Oversampling.hpp"
+#include "BME680_Timing.hpp"
+
+const double BME680_OversamplingController::HYSTERESIS = 0.75;
+
+BME680_OversamplingController::BME680_OversamplingController()
+	: period(0), overhead(0), window(32), samples(0)
+{
+	for (uint8_t c = 0; c < CHANNELS; c++)
+	{
+		budget[c] = 0.0;
+		code[c] = BME680_Base::Ctrl_meas::osrs_t::X16;
+		last[c] = 0.0;
+		haveLast[c] = false;
+	}
+}
+
+void BME680_OversamplingController::setNoiseBudget(uint8_t channel, double sigma)
+{
+	budget[channel] = sigma;
+	if (sigma <= 0.0)
+		code[channel] = BME680_Base::Ctrl_meas::osrs_t::SKIPPED;
+	else if (code[channel] == BME680_Base::Ctrl_meas::osrs_t::SKIPPED)
+		code[channel] = BME680_Base::Ctrl_meas::osrs_t::X16;
+}
+
+void BME680_OversamplingController::setSamplePeriod(uint32_t periodUs, uint32_t overheadUs)
+{
+	period = periodUs;
+	overhead = overheadUs;
+}
+
+void BME680_OversamplingController::setWindow(uint16_t n)
+{
+	window = n > 2 ? n : 2;
+}
+
+uint32_t BME680_OversamplingController::duration() const
+{
+	return BME680_Timing::tphg(code[BME680_Channel::TEMPERATURE], code[BME680_Channel::PRESSURE],
+		code[BME680_Channel::HUMIDITY], false);
+}
+
+bool BME680_OversamplingController::update(const BME680_Sample &sample)
+{
+	for (uint8_t c = 0; c < CHANNELS; c++)
+	{
+		if (!sample.isValid(c))
+			continue;
+		if (haveLast[c])
+			diff[c].add(sample.value[c] - last[c]);
+		last[c] = sample.value[c];
+		haveLast[c] = true;
+	}
+	if (++samples < window)
+		return false;
+
+	uint8_t before[CHANNELS];
+	for (uint8_t c = 0; c < CHANNELS; c++)
+		before[c] = code[c];
+	choose();
+	samples = 0;
+	bool changed = false;
+	for (uint8_t c = 0; c < CHANNELS; c++)
+	{
+		diff[c].reset();
+		changed = changed || code[c] != before[c];
+	}
+	return changed;
+}
+
+uint8_t BME680_OversamplingController::select(double factor)
+{
+	if (factor >= 16.0)
+		return BME680_Base::Ctrl_meas::osrs_t::X16;
+	if (factor <= 1.0)
+		return BME680_Base::Ctrl_meas::osrs_t::X1;
+	return BME680_Timing::code((uint8_t)std::ceil(factor));
+}
+
+void BME680_OversamplingController::choose()
+{
+	for (uint8_t c = 0; c < CHANNELS; c++)
+	{
+		if (budget[c] <= 0.0 || diff[c].count() < 2)
+			continue;
+		double sigma = std::sqrt(diff[c].variance() / 2.0);
+		double sigma1 = sigma * std::sqrt((double)BME680_Timing::factor(code[c]));
+		double needed = (sigma1 / budget[c]) * (sigma1 / budget[c]);
+		/*
+		 * Step up as soon as needed, step down only with some margin to avoid toggling:
+		 * noise within HYSTERESIS * budget needs HYSTERESIS^-2 times the factor
+		 */
+		uint8_t up = select(needed), down = select(needed / (HYSTERESIS * HYSTERESIS));
+		if (up > code[c])
+			code[c] = up;
+		else if (down < code[c])
+			code[c] = down;
+	}
+
+	/* Give up accuracy on the most oversampled channel until the cycle fits the period */
+	while (period && duration() + overhead > period)
+	{
+		uint8_t largest = 0;
+		for (uint8_t c = 1; c < CHANNELS; c++)
+			if (code[c] > code[largest])
+				largest = c;
+		if (code[largest] <= BME680_Base::Ctrl_meas::osrs_t::X1)
+			break;
+		code[largest]--;
+	}
+}
+
+void BME680_OversamplingController::apply(BME680_Measurement &meas) const
+{
+	/* The measurement writes Ctrl_hum and Ctrl_meas with its next start and keeps its register cache right */
+	meas.setOversampling(code[BME680_Channel::TEMPERATURE], code[BME680_Channel::PRESSURE], code[BME680_Channel::HUMIDITY]);
+}
@@ -0,0 +1,73 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Oversampling.hpp
+ */
+
+#ifndef BME680_OVERSAMPLING_HPP
+#define BME680_OVERSAMPLING_HPP
+
+#include <cinttypes>
+#include "BME680_Core.hpp"
+#include "BME680_Measurement.hpp"
+#include "BME680_Sample.hpp"
+#include "BME680_Stats.hpp"
+
+/*
+ * Adaptive choice of osrs_t, osrs_p and osrs_h.
+ *
+ * The noise of each channel is estimated from the variance of successive differences
+ * of the compensated values (var(x[n] - x[n-1]) = 2 sigma^2 for white noise on a slow
+ * signal). Oversampling by N reduces white noise by sqrt(N), so the noise at X1 is
+ * sigma * sqrt(N_current) and the lowest N meeting the noise budget follows directly.
+ * If the resulting conversion time does not fit the sample period, the largest
+ * factors are reduced until it does. The choice is handed to BME680_Measurement, which
+ * writes the registers with its next start() only when they change.
+ */
+class BME680_OversamplingController
+{
+public:
+	/* Number of controlled channels: temperature, pressure, humidity (BME680_Channel order) */
+	static const uint8_t CHANNELS = 3;
+	/* A lower oversampling is only chosen if its noise stays below this fraction of the budget */
+	static const double HYSTERESIS;
+
+	BME680_OversamplingController();
+
+	/* Allowed noise (standard deviation in channel units), <= 0 skips the channel */
+	void setNoiseBudget(uint8_t channel, double sigma);
+	/* Time available per sample and extra time per cycle (e.g. heater wait), in us */
+	void setSamplePeriod(uint32_t periodUs, uint32_t overheadUs = 0);
+	/* Number of samples between two decisions */
+	void setWindow(uint16_t samples);
+
+	/* Feed a compensated sample, returns true if the oversampling choice changed */
+	bool update(const BME680_Sample &sample);
+
+	/* Current osrs_x codes */
+	uint8_t osrs(uint8_t channel) const { return code[channel]; }
+	/* Conversion time of the current choice in us */
+	uint32_t duration() const;
+
+	/* Use the current choice for the next measurements (BME680_Measurement::setOversampling) */
+	void apply(BME680_Measurement &meas) const;
+
+private:
+	void choose();
+	static uint8_t select(double factor);
+
+	double budget[CHANNELS];
+	uint8_t code[CHANNELS];
+	uint32_t period;
+	uint32_t overhead;
+	uint16_t window;
+	uint16_t samples;
+	double last[CHANNELS];
+	bool haveLast[CHANNELS];
+	BME680_RunningStats diff[CHANNELS];
+};
+
+#endif
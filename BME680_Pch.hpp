@@ -0,0 +1,35 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Pch.hpp
+ */
+
+#ifndef BME680_PCH_HPP
+#define BME680_PCH_HPP
+
+/*
+ * Precompiled header of the register layer and the headers most modules use.
+ * Build it once with the flags of the project and force it into every translation unit:
+ *
+ *   g++ $CXXFLAGS -x c++-header BME680_Pch.hpp -o BME680_Pch.hpp.gch
+ *   g++ $CXXFLAGS -include BME680_Pch.hpp -c BME680_Measurement.cpp
+ *
+ * The .gch is only used if the flags match, otherwise the header is parsed as usual.
+ */
+
+#include <cinttypes>
+#include <cstring>
+#include <cmath>
+#include "BME680.hpp"
+#include "BME680_Registers.hpp"
+#include "BME680_Clock.hpp"
+#include "BME680_Sample.hpp"
+#include "BME680_Timing.hpp"
+#include "BME680_Calibration.hpp"
+#include "BME680_Compensation.hpp"
+#include "BME680_Measurement.hpp"
+
+#endif
@@ -0,0 +1,45 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Record.cpp
+ */
+
+#include <cstring>
+#include <cmath>
+#include "BME680.hpp"
+#include "BME680_Record.hpp"
+
+void BME680_fillRecord(bme680_record &record, uint32_t sensorId, uint64_t timestamp,
+	const BME680_RawSample &raw, const BME680_Sample &sample)
+{
+	typedef BME680_Base B;
+	memset(&record, 0, sizeof(record));
+	record.version = BME680_RECORD_VERSION;
+	record.size = BME680_RECORD_SIZE;
+	record.sensor_id = sensorId;
+	record.timestamp_us = timestamp;
+	record.temperature = (int32_t)std::floor(sample.value[BME680_Channel::TEMPERATURE] * 100.0 + 0.5);
+	record.pressure = (uint32_t)(sample.value[BME680_Channel::PRESSURE] + 0.5);
+	record.humidity = (uint32_t)(sample.value[BME680_Channel::HUMIDITY] * 1000.0 + 0.5);
+	record.gas_resistance = (uint32_t)(sample.value[BME680_Channel::GAS] + 0.5);
+	memcpy(record.raw, raw.registers, sizeof(record.raw));
+	record.valid = sample.valid;
+	record.flags = (uint8_t)(((raw.status & B::meas_status_0::new_data_0::mask) ? BME680_RECORD_NEW_DATA : 0)
+		| ((raw.gasStatus & B::gas_r_lsb::gas_valid_r::mask) ? BME680_RECORD_GAS_VALID : 0)
+		| ((raw.gasStatus & B::gas_r_lsb::heat_stab_r::mask) ? BME680_RECORD_HEAT_STAB : 0));
+	record.gas_meas_index = raw.gasIndex();
+}
+
+void BME680_recordSample(const bme680_record &record, BME680_Sample &sample)
+{
+	sample = BME680_Sample();
+	sample.timestamp = (uint32_t)(record.timestamp_us / 1000);
+	sample.value[BME680_Channel::TEMPERATURE] = record.temperature / 100.0;
+	sample.value[BME680_Channel::PRESSURE] = record.pressure;
+	sample.value[BME680_Channel::HUMIDITY] = record.humidity / 1000.0;
+	sample.value[BME680_Channel::GAS] = record.gas_resistance;
+	sample.valid = record.valid;
+}
@@ -0,0 +1,25 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Record.hpp
+ */
+
+#ifndef BME680_RECORD_HPP
+#define BME680_RECORD_HPP
+
+#include <cinttypes>
+#include "bme680_record.h"
+#include "BME680_Measurement.hpp"
+#include "BME680_Sample.hpp"
+
+/* Fill a record from a raw and a compensated sample, no allocation */
+void BME680_fillRecord(bme680_record &record, uint32_t sensorId, uint64_t timestamp,
+	const BME680_RawSample &raw, const BME680_Sample &sample);
+
+/* Compensated values of a record as sample (timestamp in ms) */
+void BME680_recordSample(const bme680_record &record, BME680_Sample &sample);
+
+#endif
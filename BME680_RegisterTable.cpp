@@ -0,0 +1,496 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_RegisterTable.cpp
+ */
+
+/*
+ * Register map tables of BME680_Registers.hpp, generated from the same description as
+ * the register structs. Masks, defaults and enumerated values refer to the constants of
+ * BME680_Base, the lookup functions are in BME680_Registers.cpp.
+ */
+
+#include "BME680.hpp"
+#include "BME680_Registers.hpp"
+
+static const BME680_EnumInfo BME680_values_Gas_wait_0_gas_wait_mult[] =
+{
+	{ "X1", BME680_Base::Gas_wait_0::gas_wait_mult::X1 },
+	{ "X4", BME680_Base::Gas_wait_0::gas_wait_mult::X4 },
+	{ "X16", BME680_Base::Gas_wait_0::gas_wait_mult::X16 },
+	{ "X64", BME680_Base::Gas_wait_0::gas_wait_mult::X64 }
+};
+
+static const BME680_EnumInfo BME680_values_Gas_wait_1_gas_wait_mult[] =
+{
+	{ "X1", BME680_Base::Gas_wait_1::gas_wait_mult::X1 },
+	{ "X4", BME680_Base::Gas_wait_1::gas_wait_mult::X4 },
+	{ "X16", BME680_Base::Gas_wait_1::gas_wait_mult::X16 },
+	{ "X64", BME680_Base::Gas_wait_1::gas_wait_mult::X64 }
+};
+
+static const BME680_EnumInfo BME680_values_Gas_wait_2_gas_wait_mult[] =
+{
+	{ "X1", BME680_Base::Gas_wait_2::gas_wait_mult::X1 },
+	{ "X4", BME680_Base::Gas_wait_2::gas_wait_mult::X4 },
+	{ "X16", BME680_Base::Gas_wait_2::gas_wait_mult::X16 },
+	{ "X64", BME680_Base::Gas_wait_2::gas_wait_mult::X64 }
+};
+
+static const BME680_EnumInfo BME680_values_Gas_wait_3_gas_wait_mult[] =
+{
+	{ "X1", BME680_Base::Gas_wait_3::gas_wait_mult::X1 },
+	{ "X4", BME680_Base::Gas_wait_3::gas_wait_mult::X4 },
+	{ "X16", BME680_Base::Gas_wait_3::gas_wait_mult::X16 },
+	{ "X64", BME680_Base::Gas_wait_3::gas_wait_mult::X64 }
+};
+
+static const BME680_EnumInfo BME680_values_Gas_wait_4_gas_wait_mult[] =
+{
+	{ "X1", BME680_Base::Gas_wait_4::gas_wait_mult::X1 },
+	{ "X4", BME680_Base::Gas_wait_4::gas_wait_mult::X4 },
+	{ "X16", BME680_Base::Gas_wait_4::gas_wait_mult::X16 },
+	{ "X64", BME680_Base::Gas_wait_4::gas_wait_mult::X64 }
+};
+
+static const BME680_EnumInfo BME680_values_Gas_wait_5_gas_wait_mult[] =
+{
+	{ "X1", BME680_Base::Gas_wait_5::gas_wait_mult::X1 },
+	{ "X4", BME680_Base::Gas_wait_5::gas_wait_mult::X4 },
+	{ "X16", BME680_Base::Gas_wait_5::gas_wait_mult::X16 },
+	{ "X64", BME680_Base::Gas_wait_5::gas_wait_mult::X64 }
+};
+
+static const BME680_EnumInfo BME680_values_Gas_wait_6_gas_wait_mult[] =
+{
+	{ "X1", BME680_Base::Gas_wait_6::gas_wait_mult::X1 },
+	{ "X4", BME680_Base::Gas_wait_6::gas_wait_mult::X4 },
+	{ "X16", BME680_Base::Gas_wait_6::gas_wait_mult::X16 },
+	{ "X64", BME680_Base::Gas_wait_6::gas_wait_mult::X64 }
+};
+
+static const BME680_EnumInfo BME680_values_Gas_wait_7_gas_wait_mult[] =
+{
+	{ "X1", BME680_Base::Gas_wait_7::gas_wait_mult::X1 },
+	{ "X4", BME680_Base::Gas_wait_7::gas_wait_mult::X4 },
+	{ "X16", BME680_Base::Gas_wait_7::gas_wait_mult::X16 },
+	{ "X64", BME680_Base::Gas_wait_7::gas_wait_mult::X64 }
+};
+
+static const BME680_EnumInfo BME680_values_Gas_wait_8_gas_wait_mult[] =
+{
+	{ "X1", BME680_Base::Gas_wait_8::gas_wait_mult::X1 },
+	{ "X4", BME680_Base::Gas_wait_8::gas_wait_mult::X4 },
+	{ "X16", BME680_Base::Gas_wait_8::gas_wait_mult::X16 },
+	{ "X64", BME680_Base::Gas_wait_8::gas_wait_mult::X64 }
+};
+
+static const BME680_EnumInfo BME680_values_Gas_wait_9_gas_wait_mult[] =
+{
+	{ "X1", BME680_Base::Gas_wait_9::gas_wait_mult::X1 },
+	{ "X4", BME680_Base::Gas_wait_9::gas_wait_mult::X4 },
+	{ "X16", BME680_Base::Gas_wait_9::gas_wait_mult::X16 },
+	{ "X64", BME680_Base::Gas_wait_9::gas_wait_mult::X64 }
+};
+
+static const BME680_EnumInfo BME680_values_Ctrl_gas_0_heat_off[] =
+{
+	{ "HEAT_OFF", BME680_Base::Ctrl_gas_0::heat_off::HEAT_OFF },
+	{ "HEAT_ON", BME680_Base::Ctrl_gas_0::heat_off::HEAT_ON }
+};
+
+static const BME680_EnumInfo BME680_values_Ctrl_hum_osrs_h[] =
+{
+	{ "SKIPPED", BME680_Base::Ctrl_hum::osrs_h::SKIPPED },
+	{ "X1", BME680_Base::Ctrl_hum::osrs_h::X1 },
+	{ "X2", BME680_Base::Ctrl_hum::osrs_h::X2 },
+	{ "X4", BME680_Base::Ctrl_hum::osrs_h::X4 },
+	{ "X8", BME680_Base::Ctrl_hum::osrs_h::X8 },
+	{ "X16", BME680_Base::Ctrl_hum::osrs_h::X16 }
+};
+
+static const BME680_EnumInfo BME680_values_Ctrl_meas_osrs_t[] =
+{
+	{ "SKIPPED", BME680_Base::Ctrl_meas::osrs_t::SKIPPED },
+	{ "X1", BME680_Base::Ctrl_meas::osrs_t::X1 },
+	{ "X2", BME680_Base::Ctrl_meas::osrs_t::X2 },
+	{ "X4", BME680_Base::Ctrl_meas::osrs_t::X4 },
+	{ "X8", BME680_Base::Ctrl_meas::osrs_t::X8 },
+	{ "X16", BME680_Base::Ctrl_meas::osrs_t::X16 }
+};
+
+static const BME680_EnumInfo BME680_values_Ctrl_meas_osrs_p[] =
+{
+	{ "SKIPPED", BME680_Base::Ctrl_meas::osrs_p::SKIPPED },
+	{ "X1", BME680_Base::Ctrl_meas::osrs_p::X1 },
+	{ "X2", BME680_Base::Ctrl_meas::osrs_p::X2 },
+	{ "X4", BME680_Base::Ctrl_meas::osrs_p::X4 },
+	{ "X8", BME680_Base::Ctrl_meas::osrs_p::X8 },
+	{ "X16", BME680_Base::Ctrl_meas::osrs_p::X16 }
+};
+
+static const BME680_EnumInfo BME680_values_Ctrl_meas_mode[] =
+{
+	{ "SLEEP", BME680_Base::Ctrl_meas::mode::SLEEP },
+	{ "FORCED", BME680_Base::Ctrl_meas::mode::FORCED }
+};
+
+static const BME680_EnumInfo BME680_values_RESET_Reset[] =
+{
+	{ "RESET", BME680_Base::RESET::Reset::RESET }
+};
+
+static const BME680_FieldInfo BME680_fields_meas_status_0[] =
+{
+	{ "new_data_0", BME680_Base::meas_status_0::new_data_0::mask, BME680_Base::meas_status_0::new_data_0::dflt, 0, 0 },
+	{ "gas_measuring", BME680_Base::meas_status_0::gas_measuring::mask, BME680_Base::meas_status_0::gas_measuring::dflt, 0, 0 },
+	{ "measuring", BME680_Base::meas_status_0::measuring::mask, BME680_Base::meas_status_0::measuring::dflt, 0, 0 },
+	{ "unused_0", BME680_Base::meas_status_0::unused_0::mask, BME680_Base::meas_status_0::unused_0::dflt, 0, 0 },
+	{ "gas_meas_index_0", BME680_Base::meas_status_0::gas_meas_index_0::mask, BME680_Base::meas_status_0::gas_meas_index_0::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_press_msb[] =
+{
+	{ "press_msb_", BME680_Base::press_msb::press_msb_::mask, BME680_Base::press_msb::press_msb_::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_press_lsb[] =
+{
+	{ "press_lsb_", BME680_Base::press_lsb::press_lsb_::mask, BME680_Base::press_lsb::press_lsb_::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_press_xlsb[] =
+{
+	{ "press_xlsb_", BME680_Base::press_xlsb::press_xlsb_::mask, BME680_Base::press_xlsb::press_xlsb_::dflt, 0, 0 },
+	{ "unused_0", BME680_Base::press_xlsb::unused_0::mask, BME680_Base::press_xlsb::unused_0::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_temp_msb[] =
+{
+	{ "temp_msb_", BME680_Base::temp_msb::temp_msb_::mask, BME680_Base::temp_msb::temp_msb_::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_temp_lsb[] =
+{
+	{ "temp_lsb_", BME680_Base::temp_lsb::temp_lsb_::mask, BME680_Base::temp_lsb::temp_lsb_::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_temp_xlsb[] =
+{
+	{ "temp_xlsb_", BME680_Base::temp_xlsb::temp_xlsb_::mask, BME680_Base::temp_xlsb::temp_xlsb_::dflt, 0, 0 },
+	{ "unused_0", BME680_Base::temp_xlsb::unused_0::mask, BME680_Base::temp_xlsb::unused_0::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_hum_msb[] =
+{
+	{ "hum_msb_", BME680_Base::hum_msb::hum_msb_::mask, BME680_Base::hum_msb::hum_msb_::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_hum_lsb[] =
+{
+	{ "hum_lsb_", BME680_Base::hum_lsb::hum_lsb_::mask, BME680_Base::hum_lsb::hum_lsb_::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_gas_r_msb[] =
+{
+	{ "gas_r", BME680_Base::gas_r_msb::gas_r::mask, BME680_Base::gas_r_msb::gas_r::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_gas_r_lsb[] =
+{
+	{ "gas_r", BME680_Base::gas_r_lsb::gas_r::mask, BME680_Base::gas_r_lsb::gas_r::dflt, 0, 0 },
+	{ "gas_valid_r", BME680_Base::gas_r_lsb::gas_valid_r::mask, BME680_Base::gas_r_lsb::gas_valid_r::dflt, 0, 0 },
+	{ "heat_stab_r", BME680_Base::gas_r_lsb::heat_stab_r::mask, BME680_Base::gas_r_lsb::heat_stab_r::dflt, 0, 0 },
+	{ "gas_range_r", BME680_Base::gas_r_lsb::gas_range_r::mask, BME680_Base::gas_r_lsb::gas_range_r::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Idac_heat_0[] =
+{
+	{ "idac_heat", BME680_Base::Idac_heat_0::idac_heat::mask, BME680_Base::Idac_heat_0::idac_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Idac_heat_1[] =
+{
+	{ "idac_heat", BME680_Base::Idac_heat_1::idac_heat::mask, BME680_Base::Idac_heat_1::idac_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Idac_heat_2[] =
+{
+	{ "idac_heat", BME680_Base::Idac_heat_2::idac_heat::mask, BME680_Base::Idac_heat_2::idac_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Idac_heat_3[] =
+{
+	{ "idac_heat", BME680_Base::Idac_heat_3::idac_heat::mask, BME680_Base::Idac_heat_3::idac_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Idac_heat_4[] =
+{
+	{ "idac_heat", BME680_Base::Idac_heat_4::idac_heat::mask, BME680_Base::Idac_heat_4::idac_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Idac_heat_5[] =
+{
+	{ "idac_heat", BME680_Base::Idac_heat_5::idac_heat::mask, BME680_Base::Idac_heat_5::idac_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Idac_heat_6[] =
+{
+	{ "idac_heat", BME680_Base::Idac_heat_6::idac_heat::mask, BME680_Base::Idac_heat_6::idac_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Idac_heat_7[] =
+{
+	{ "idac_heat", BME680_Base::Idac_heat_7::idac_heat::mask, BME680_Base::Idac_heat_7::idac_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Idac_heat_8[] =
+{
+	{ "idac_heat", BME680_Base::Idac_heat_8::idac_heat::mask, BME680_Base::Idac_heat_8::idac_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Idac_heat_9[] =
+{
+	{ "idac_heat", BME680_Base::Idac_heat_9::idac_heat::mask, BME680_Base::Idac_heat_9::idac_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Res_heat_0[] =
+{
+	{ "res_heat", BME680_Base::Res_heat_0::res_heat::mask, BME680_Base::Res_heat_0::res_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Res_heat_1[] =
+{
+	{ "res_heat", BME680_Base::Res_heat_1::res_heat::mask, BME680_Base::Res_heat_1::res_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Res_heat_2[] =
+{
+	{ "res_heat", BME680_Base::Res_heat_2::res_heat::mask, BME680_Base::Res_heat_2::res_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Res_heat_3[] =
+{
+	{ "res_heat", BME680_Base::Res_heat_3::res_heat::mask, BME680_Base::Res_heat_3::res_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Res_heat_4[] =
+{
+	{ "res_heat", BME680_Base::Res_heat_4::res_heat::mask, BME680_Base::Res_heat_4::res_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Res_heat_5[] =
+{
+	{ "res_heat", BME680_Base::Res_heat_5::res_heat::mask, BME680_Base::Res_heat_5::res_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Res_heat_6[] =
+{
+	{ "res_heat", BME680_Base::Res_heat_6::res_heat::mask, BME680_Base::Res_heat_6::res_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Res_heat_7[] =
+{
+	{ "res_heat", BME680_Base::Res_heat_7::res_heat::mask, BME680_Base::Res_heat_7::res_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Res_heat_8[] =
+{
+	{ "res_heat", BME680_Base::Res_heat_8::res_heat::mask, BME680_Base::Res_heat_8::res_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Res_heat_9[] =
+{
+	{ "res_heat", BME680_Base::Res_heat_9::res_heat::mask, BME680_Base::Res_heat_9::res_heat::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Gas_wait_0[] =
+{
+	{ "gas_wait_mult", BME680_Base::Gas_wait_0::gas_wait_mult::mask, BME680_Base::Gas_wait_0::gas_wait_mult::dflt, BME680_values_Gas_wait_0_gas_wait_mult, 4 },
+	{ "gas_wait_val", BME680_Base::Gas_wait_0::gas_wait_val::mask, BME680_Base::Gas_wait_0::gas_wait_val::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Gas_wait_1[] =
+{
+	{ "gas_wait_mult", BME680_Base::Gas_wait_1::gas_wait_mult::mask, BME680_Base::Gas_wait_1::gas_wait_mult::dflt, BME680_values_Gas_wait_1_gas_wait_mult, 4 },
+	{ "gas_wait_val", BME680_Base::Gas_wait_1::gas_wait_val::mask, BME680_Base::Gas_wait_1::gas_wait_val::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Gas_wait_2[] =
+{
+	{ "gas_wait_mult", BME680_Base::Gas_wait_2::gas_wait_mult::mask, BME680_Base::Gas_wait_2::gas_wait_mult::dflt, BME680_values_Gas_wait_2_gas_wait_mult, 4 },
+	{ "gas_wait_val", BME680_Base::Gas_wait_2::gas_wait_val::mask, BME680_Base::Gas_wait_2::gas_wait_val::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Gas_wait_3[] =
+{
+	{ "gas_wait_mult", BME680_Base::Gas_wait_3::gas_wait_mult::mask, BME680_Base::Gas_wait_3::gas_wait_mult::dflt, BME680_values_Gas_wait_3_gas_wait_mult, 4 },
+	{ "gas_wait_val", BME680_Base::Gas_wait_3::gas_wait_val::mask, BME680_Base::Gas_wait_3::gas_wait_val::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Gas_wait_4[] =
+{
+	{ "gas_wait_mult", BME680_Base::Gas_wait_4::gas_wait_mult::mask, BME680_Base::Gas_wait_4::gas_wait_mult::dflt, BME680_values_Gas_wait_4_gas_wait_mult, 4 },
+	{ "gas_wait_val", BME680_Base::Gas_wait_4::gas_wait_val::mask, BME680_Base::Gas_wait_4::gas_wait_val::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Gas_wait_5[] =
+{
+	{ "gas_wait_mult", BME680_Base::Gas_wait_5::gas_wait_mult::mask, BME680_Base::Gas_wait_5::gas_wait_mult::dflt, BME680_values_Gas_wait_5_gas_wait_mult, 4 },
+	{ "gas_wait_val", BME680_Base::Gas_wait_5::gas_wait_val::mask, BME680_Base::Gas_wait_5::gas_wait_val::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Gas_wait_6[] =
+{
+	{ "gas_wait_mult", BME680_Base::Gas_wait_6::gas_wait_mult::mask, BME680_Base::Gas_wait_6::gas_wait_mult::dflt, BME680_values_Gas_wait_6_gas_wait_mult, 4 },
+	{ "gas_wait_val", BME680_Base::Gas_wait_6::gas_wait_val::mask, BME680_Base::Gas_wait_6::gas_wait_val::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Gas_wait_7[] =
+{
+	{ "gas_wait_mult", BME680_Base::Gas_wait_7::gas_wait_mult::mask, BME680_Base::Gas_wait_7::gas_wait_mult::dflt, BME680_values_Gas_wait_7_gas_wait_mult, 4 },
+	{ "gas_wait_val", BME680_Base::Gas_wait_7::gas_wait_val::mask, BME680_Base::Gas_wait_7::gas_wait_val::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Gas_wait_8[] =
+{
+	{ "gas_wait_mult", BME680_Base::Gas_wait_8::gas_wait_mult::mask, BME680_Base::Gas_wait_8::gas_wait_mult::dflt, BME680_values_Gas_wait_8_gas_wait_mult, 4 },
+	{ "gas_wait_val", BME680_Base::Gas_wait_8::gas_wait_val::mask, BME680_Base::Gas_wait_8::gas_wait_val::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Gas_wait_9[] =
+{
+	{ "gas_wait_mult", BME680_Base::Gas_wait_9::gas_wait_mult::mask, BME680_Base::Gas_wait_9::gas_wait_mult::dflt, BME680_values_Gas_wait_9_gas_wait_mult, 4 },
+	{ "gas_wait_val", BME680_Base::Gas_wait_9::gas_wait_val::mask, BME680_Base::Gas_wait_9::gas_wait_val::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Ctrl_gas_0[] =
+{
+	{ "unused_0", BME680_Base::Ctrl_gas_0::unused_0::mask, BME680_Base::Ctrl_gas_0::unused_0::dflt, 0, 0 },
+	{ "heat_off", BME680_Base::Ctrl_gas_0::heat_off::mask, BME680_Base::Ctrl_gas_0::heat_off::dflt, BME680_values_Ctrl_gas_0_heat_off, 2 },
+	{ "unused_1", BME680_Base::Ctrl_gas_0::unused_1::mask, BME680_Base::Ctrl_gas_0::unused_1::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Ctrl_gas_1[] =
+{
+	{ "unused_0", BME680_Base::Ctrl_gas_1::unused_0::mask, BME680_Base::Ctrl_gas_1::unused_0::dflt, 0, 0 },
+	{ "run_gas", BME680_Base::Ctrl_gas_1::run_gas::mask, BME680_Base::Ctrl_gas_1::run_gas::dflt, 0, 0 },
+	{ "nb_conv", BME680_Base::Ctrl_gas_1::nb_conv::mask, BME680_Base::Ctrl_gas_1::nb_conv::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Ctrl_hum[] =
+{
+	{ "unused_0", BME680_Base::Ctrl_hum::unused_0::mask, BME680_Base::Ctrl_hum::unused_0::dflt, 0, 0 },
+	{ "spi_3w_int_en", BME680_Base::Ctrl_hum::spi_3w_int_en::mask, BME680_Base::Ctrl_hum::spi_3w_int_en::dflt, 0, 0 },
+	{ "unused_1", BME680_Base::Ctrl_hum::unused_1::mask, BME680_Base::Ctrl_hum::unused_1::dflt, 0, 0 },
+	{ "osrs_h", BME680_Base::Ctrl_hum::osrs_h::mask, BME680_Base::Ctrl_hum::osrs_h::dflt, BME680_values_Ctrl_hum_osrs_h, 6 }
+};
+
+static const BME680_FieldInfo BME680_fields_STATUS[] =
+{
+	{ "unused_0", BME680_Base::STATUS::unused_0::mask, BME680_Base::STATUS::unused_0::dflt, 0, 0 },
+	{ "spi_mem_page", BME680_Base::STATUS::spi_mem_page::mask, BME680_Base::STATUS::spi_mem_page::dflt, 0, 0 },
+	{ "unused_1", BME680_Base::STATUS::unused_1::mask, BME680_Base::STATUS::unused_1::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Ctrl_meas[] =
+{
+	{ "osrs_t", BME680_Base::Ctrl_meas::osrs_t::mask, BME680_Base::Ctrl_meas::osrs_t::dflt, BME680_values_Ctrl_meas_osrs_t, 6 },
+	{ "osrs_p", BME680_Base::Ctrl_meas::osrs_p::mask, BME680_Base::Ctrl_meas::osrs_p::dflt, BME680_values_Ctrl_meas_osrs_p, 6 },
+	{ "mode", BME680_Base::Ctrl_meas::mode::mask, BME680_Base::Ctrl_meas::mode::dflt, BME680_values_Ctrl_meas_mode, 2 }
+};
+
+static const BME680_FieldInfo BME680_fields_Config[] =
+{
+	{ "unused_0", BME680_Base::Config::unused_0::mask, BME680_Base::Config::unused_0::dflt, 0, 0 },
+	{ "filter", BME680_Base::Config::filter::mask, BME680_Base::Config::filter::dflt, 0, 0 },
+	{ "unused_1", BME680_Base::Config::unused_1::mask, BME680_Base::Config::unused_1::dflt, 0, 0 },
+	{ "spi_3w_en", BME680_Base::Config::spi_3w_en::mask, BME680_Base::Config::spi_3w_en::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_Id[] =
+{
+	{ "chip_id", BME680_Base::Id::chip_id::mask, BME680_Base::Id::chip_id::dflt, 0, 0 }
+};
+
+static const BME680_FieldInfo BME680_fields_RESET[] =
+{
+	{ "Reset", BME680_Base::RESET::Reset::mask, BME680_Base::RESET::Reset::dflt, BME680_values_RESET_Reset, 1 }
+};
+
+const BME680_RegisterInfo BME680_registers[] =
+{
+	{ BME680_Base::meas_status_0::__address, "meas_status_0", BME680_Access::READ, BME680_fields_meas_status_0, 5 },
+	{ BME680_Base::press_msb::__address, "press_msb", BME680_Access::READ, BME680_fields_press_msb, 1 },
+	{ BME680_Base::press_lsb::__address, "press_lsb", BME680_Access::READ, BME680_fields_press_lsb, 1 },
+	{ BME680_Base::press_xlsb::__address, "press_xlsb", BME680_Access::READ, BME680_fields_press_xlsb, 2 },
+	{ BME680_Base::temp_msb::__address, "temp_msb", BME680_Access::READ, BME680_fields_temp_msb, 1 },
+	{ BME680_Base::temp_lsb::__address, "temp_lsb", BME680_Access::READ, BME680_fields_temp_lsb, 1 },
+	{ BME680_Base::temp_xlsb::__address, "temp_xlsb", BME680_Access::READ, BME680_fields_temp_xlsb, 2 },
+	{ BME680_Base::hum_msb::__address, "hum_msb", BME680_Access::READ, BME680_fields_hum_msb, 1 },
+	{ BME680_Base::hum_lsb::__address, "hum_lsb", BME680_Access::READ, BME680_fields_hum_lsb, 1 },
+	{ BME680_Base::gas_r_msb::__address, "gas_r_msb", BME680_Access::READ, BME680_fields_gas_r_msb, 1 },
+	{ BME680_Base::gas_r_lsb::__address, "gas_r_lsb", BME680_Access::READ, BME680_fields_gas_r_lsb, 4 },
+	{ BME680_Base::Idac_heat_0::__address, "Idac_heat_0", BME680_Access::READ_WRITE, BME680_fields_Idac_heat_0, 1 },
+	{ BME680_Base::Idac_heat_1::__address, "Idac_heat_1", BME680_Access::READ_WRITE, BME680_fields_Idac_heat_1, 1 },
+	{ BME680_Base::Idac_heat_2::__address, "Idac_heat_2", BME680_Access::READ_WRITE, BME680_fields_Idac_heat_2, 1 },
+	{ BME680_Base::Idac_heat_3::__address, "Idac_heat_3", BME680_Access::READ_WRITE, BME680_fields_Idac_heat_3, 1 },
+	{ BME680_Base::Idac_heat_4::__address, "Idac_heat_4", BME680_Access::READ_WRITE, BME680_fields_Idac_heat_4, 1 },
+	{ BME680_Base::Idac_heat_5::__address, "Idac_heat_5", BME680_Access::READ_WRITE, BME680_fields_Idac_heat_5, 1 },
+	{ BME680_Base::Idac_heat_6::__address, "Idac_heat_6", BME680_Access::READ_WRITE, BME680_fields_Idac_heat_6, 1 },
+	{ BME680_Base::Idac_heat_7::__address, "Idac_heat_7", BME680_Access::READ_WRITE, BME680_fields_Idac_heat_7, 1 },
+	{ BME680_Base::Idac_heat_8::__address, "Idac_heat_8", BME680_Access::READ_WRITE, BME680_fields_Idac_heat_8, 1 },
+	{ BME680_Base::Idac_heat_9::__address, "Idac_heat_9", BME680_Access::READ_WRITE, BME680_fields_Idac_heat_9, 1 },
+	{ BME680_Base::Res_heat_0::__address, "Res_heat_0", BME680_Access::READ_WRITE, BME680_fields_Res_heat_0, 1 },
+	{ BME680_Base::Res_heat_1::__address, "Res_heat_1", BME680_Access::READ_WRITE, BME680_fields_Res_heat_1, 1 },
+	{ BME680_Base::Res_heat_2::__address, "Res_heat_2", BME680_Access::READ_WRITE, BME680_fields_Res_heat_2, 1 },
+	{ BME680_Base::Res_heat_3::__address, "Res_heat_3", BME680_Access::READ_WRITE, BME680_fields_Res_heat_3, 1 },
+	{ BME680_Base::Res_heat_4::__address, "Res_heat_4", BME680_Access::READ_WRITE, BME680_fields_Res_heat_4, 1 },
+	{ BME680_Base::Res_heat_5::__address, "Res_heat_5", BME680_Access::READ_WRITE, BME680_fields_Res_heat_5, 1 },
+	{ BME680_Base::Res_heat_6::__address, "Res_heat_6", BME680_Access::READ_WRITE, BME680_fields_Res_heat_6, 1 },
+	{ BME680_Base::Res_heat_7::__address, "Res_heat_7", BME680_Access::READ_WRITE, BME680_fields_Res_heat_7, 1 },
+	{ BME680_Base::Res_heat_8::__address, "Res_heat_8", BME680_Access::READ_WRITE, BME680_fields_Res_heat_8, 1 },
+	{ BME680_Base::Res_heat_9::__address, "Res_heat_9", BME680_Access::READ_WRITE, BME680_fields_Res_heat_9, 1 },
+	{ BME680_Base::Gas_wait_0::__address, "Gas_wait_0", BME680_Access::READ_WRITE, BME680_fields_Gas_wait_0, 2 },
+	{ BME680_Base::Gas_wait_1::__address, "Gas_wait_1", BME680_Access::READ_WRITE, BME680_fields_Gas_wait_1, 2 },
+	{ BME680_Base::Gas_wait_2::__address, "Gas_wait_2", BME680_Access::READ_WRITE, BME680_fields_Gas_wait_2, 2 },
+	{ BME680_Base::Gas_wait_3::__address, "Gas_wait_3", BME680_Access::READ_WRITE, BME680_fields_Gas_wait_3, 2 },
+	{ BME680_Base::Gas_wait_4::__address, "Gas_wait_4", BME680_Access::READ_WRITE, BME680_fields_Gas_wait_4, 2 },
+	{ BME680_Base::Gas_wait_5::__address, "Gas_wait_5", BME680_Access::READ_WRITE, BME680_fields_Gas_wait_5, 2 },
+	{ BME680_Base::Gas_wait_6::__address, "Gas_wait_6", BME680_Access::READ_WRITE, BME680_fields_Gas_wait_6, 2 },
+	{ BME680_Base::Gas_wait_7::__address, "Gas_wait_7", BME680_Access::READ_WRITE, BME680_fields_Gas_wait_7, 2 },
+	{ BME680_Base::Gas_wait_8::__address, "Gas_wait_8", BME680_Access::READ_WRITE, BME680_fields_Gas_wait_8, 2 },
+	{ BME680_Base::Gas_wait_9::__address, "Gas_wait_9", BME680_Access::READ_WRITE, BME680_fields_Gas_wait_9, 2 },
+	{ BME680_Base::Ctrl_gas_0::__address, "Ctrl_gas_0", BME680_Access::READ_WRITE, BME680_fields_Ctrl_gas_0, 3 },
+	{ BME680_Base::Ctrl_gas_1::__address, "Ctrl_gas_1", BME680_Access::READ_WRITE, BME680_fields_Ctrl_gas_1, 3 },
+	{ BME680_Base::Ctrl_hum::__address, "Ctrl_hum", BME680_Access::READ_WRITE, BME680_fields_Ctrl_hum, 4 },
+	{ BME680_Base::STATUS::__address, "STATUS", BME680_Access::READ_WRITE, BME680_fields_STATUS, 3 },
+	{ BME680_Base::Ctrl_meas::__address, "Ctrl_meas", BME680_Access::READ_WRITE, BME680_fields_Ctrl_meas, 3 },
+	{ BME680_Base::Config::__address, "Config", BME680_Access::READ_WRITE, BME680_fields_Config, 4 },
+	{ BME680_Base::Id::__address, "Id", BME680_Access::READ, BME680_fields_Id, 1 },
+	{ BME680_Base::RESET::__address, "RESET", BME680_Access::WRITE, BME680_fields_RESET, 1 }
+};
+const uint8_t BME680_registerCount = 49;
+
+const uint8_t BME680_registerIndex[256] =
+{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+	3, 4, 5, 6, 7, 8, 9, 0, 0, 0, 10, 11, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+	28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 0, 0,
+	42, 43, 44, 45, 46, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
@@ -0,0 +1,44 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Registers.cpp
+ */
+
+#include <cstring>
+#include "BME680_Registers.hpp"
+
+/* The tables are generated into BME680_RegisterTable.cpp by gen/bme680_gen.py */
+
+const BME680_RegisterInfo *BME680_findRegister(uint16_t address)
+{
+	if (address > 255 || !BME680_registerIndex[address])
+		return 0;
+	return &BME680_registers[BME680_registerIndex[address] - 1];
+}
+
+const BME680_RegisterInfo *BME680_findRegister(const char *name)
+{
+	for (uint8_t i = 0; i < BME680_registerCount; i++)
+		if (!strcmp(BME680_registers[i].name, name))
+			return &BME680_registers[i];
+	return 0;
+}
+
+const BME680_FieldInfo *BME680_findField(const BME680_RegisterInfo *reg, const char *name)
+{
+	for (uint8_t i = 0; i < reg->fieldCount; i++)
+		if (!strcmp(reg->fields[i].name, name))
+			return &reg->fields[i];
+	return 0;
+}
+
+uint8_t BME680_defaultValue(const BME680_RegisterInfo *reg)
+{
+	uint8_t value = 0;
+	for (uint8_t i = 0; i < reg->fieldCount; i++)
+		value |= (uint8_t)(reg->fields[i].dflt << BME680_fieldShift(reg->fields[i].mask)) & reg->fields[i].mask;
+	return value;
+}
@@ -0,0 +1,87 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Registers.hpp
+ */
+
+#ifndef BME680_REGISTERS_HPP
+#define BME680_REGISTERS_HPP
+
+#include <cinttypes>
+
+/*
+ * Register map of BME680_Base as constant tables for runtime introspection
+ * (register dumps, validation, simulators, debuggers). The tables are generated
+ * into BME680_RegisterTable.cpp from gen/BME680.regs together with the register
+ * structs, masks, defaults and enumerated values refer to the constants of
+ * BME680_Base. The tables are const data and end up in read-only memory.
+ */
+
+/* Access mode of a register */
+struct BME680_Access
+{
+	static const uint8_t READ = 0b01;
+	static const uint8_t WRITE = 0b10;
+	static const uint8_t READ_WRITE = 0b11;
+};
+
+/* Named value of a bit field, e.g. Ctrl_meas::osrs_t::X16 (not shifted to the field position) */
+struct BME680_EnumInfo
+{
+	const char *name;
+	uint8_t value;
+};
+
+/* Bit field of a register */
+struct BME680_FieldInfo
+{
+	const char *name;
+	uint8_t mask;
+	uint8_t dflt; // not shifted to the field position, like the dflt constants
+	const BME680_EnumInfo *values;
+	uint8_t valueCount;
+};
+
+/* Register with its bit fields, ordered from MSB to LSB */
+struct BME680_RegisterInfo
+{
+	uint16_t address;
+	const char *name;
+	uint8_t access;
+	const BME680_FieldInfo *fields;
+	uint8_t fieldCount;
+};
+
+/* All registers, sorted by address */
+extern const BME680_RegisterInfo BME680_registers[];
+extern const uint8_t BME680_registerCount;
+
+/* Dense map address -> index into BME680_registers + 1, 0 where no register exists */
+extern const uint8_t BME680_registerIndex[256];
+
+/* Lookup by address in constant time, null if there is no such register */
+const BME680_RegisterInfo *BME680_findRegister(uint16_t address);
+/* Lookup by name (e.g. "Ctrl_meas"), null if there is no such register */
+const BME680_RegisterInfo *BME680_findRegister(const char *name);
+/* Lookup of a bit field by name, null if the register has no such field */
+const BME680_FieldInfo *BME680_findField(const BME680_RegisterInfo *reg, const char *name);
+
+/* Shift of a field value to its position in the register, derived from the mask */
+inline uint8_t BME680_fieldShift(uint8_t mask)
+{
+	uint8_t shift = 0;
+	while (mask && !(mask & 1))
+	{
+		mask >>= 1;
+		shift++;
+	}
+	return shift;
+}
+
+/* Register value with all fields set to their defaults */
+uint8_t BME680_defaultValue(const BME680_RegisterInfo *reg);
+
+#endif
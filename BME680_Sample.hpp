@@ -0,0 +1,50 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Sample.hpp
+ */
+
+#ifndef BME680_SAMPLE_HPP
+#define BME680_SAMPLE_HPP
+
+#include <cinttypes>
+
+/* Index of the measured quantities in BME680_Sample::value */
+struct BME680_Channel
+{
+	static const uint8_t TEMPERATURE = 0; // degree Celsius
+	static const uint8_t PRESSURE = 1; // Pascal
+	static const uint8_t HUMIDITY = 2; // % relative humidity
+	static const uint8_t GAS = 3; // gas resistance in Ohm
+	static const uint8_t COUNT = 4;
+};
+
+/* One compensated sample as produced by a measurement cycle */
+struct BME680_Sample
+{
+	uint32_t timestamp; // milliseconds, free running (wraps around)
+	double value[BME680_Channel::COUNT];
+	uint8_t valid; // bit (1 << channel) is set if value[channel] holds a result
+
+	BME680_Sample() : timestamp(0), valid(0)
+	{
+		for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+			value[c] = 0.0;
+	}
+
+	bool isValid(uint8_t channel) const
+	{
+		return (valid >> channel) & 1;
+	}
+
+	void set(uint8_t channel, double v)
+	{
+		value[channel] = v;
+		valid |= (uint8_t)(1 << channel);
+	}
+};
+
+#endif
@@ -0,0 +1,307 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Shm.cpp
+ */
+
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "BME680_Shm.hpp"
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                              SEGMENT                                              *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+BME680_ShmSegment::BME680_ShmSegment()
+	: base(0), length(0)
+{
+}
+
+BME680_ShmSegment::~BME680_ShmSegment()
+{
+	close();
+}
+
+bool BME680_ShmSegment::create(const char *name, size_t size)
+{
+	close();
+	int fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+	if (fd < 0)
+		return false;
+	void *p = MAP_FAILED;
+	if (ftruncate(fd, (off_t)size) == 0)
+		p = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (p == MAP_FAILED)
+		return false;
+	base = p;
+	length = size;
+	return true;
+}
+
+bool BME680_ShmSegment::open(const char *name)
+{
+	close();
+	int fd = shm_open(name, O_RDONLY, 0);
+	if (fd < 0)
+		return false;
+	struct stat st;
+	void *p = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && st.st_size > 0)
+		p = mmap(0, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (p == MAP_FAILED)
+		return false;
+	base = p;
+	length = (size_t)st.st_size;
+	return true;
+}
+
+void BME680_ShmSegment::close()
+{
+	if (base)
+		munmap(base, length);
+	base = 0;
+	length = 0;
+}
+
+void BME680_ShmSegment::unlink(const char *name)
+{
+	shm_unlink(name);
+}
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                               RING                                                *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+BME680_ShmRing::BME680_ShmRing()
+	: header(0), slots(0), capacity(0)
+{
+}
+
+size_t BME680_ShmRing::size(uint32_t capacity)
+{
+	return sizeof(Header) + (size_t)capacity * sizeof(Slot);
+}
+
+bool BME680_ShmRing::attach(void *memory, size_t bytes, bool initialize)
+{
+	header = 0;
+	if (!memory || bytes < sizeof(Header))
+		return false;
+	Header *h = (Header *)memory;
+	if (initialize)
+	{
+		memset(memory, 0, bytes);
+		h->version = BME680_RECORD_VERSION;
+		h->recordSize = BME680_RECORD_SIZE;
+		size_t fit = (bytes - sizeof(Header)) / sizeof(Slot);
+		h->capacity = 0;
+		for (uint32_t c = 1; c && c <= fit; c <<= 1)
+			h->capacity = c;
+		__atomic_store_n(&h->magic, MAGIC, __ATOMIC_RELEASE);
+	}
+	if (__atomic_load_n(&h->magic, __ATOMIC_ACQUIRE) != MAGIC || h->version != BME680_RECORD_VERSION
+		|| h->recordSize != BME680_RECORD_SIZE || h->capacity == 0 || (h->capacity & (h->capacity - 1))
+		|| size(h->capacity) > bytes)
+		return false;
+	header = h;
+	slots = (Slot *)(h + 1);
+	capacity = h->capacity;
+	return true;
+}
+
+void BME680_ShmRing::push(const bme680_record &record)
+{
+	uint32_t n = __atomic_load_n(&header->head, __ATOMIC_RELAXED);
+	Slot &slot = slots[n % capacity];
+	__atomic_store_n(&slot.seq, 2 * n + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	memcpy(&slot.record, &record, sizeof(record));
+	__atomic_store_n(&slot.seq, 2 * n + 2, __ATOMIC_RELEASE);
+	__atomic_store_n(&header->head, n + 1, __ATOMIC_RELEASE);
+}
+
+uint32_t BME680_ShmRing::head() const
+{
+	return __atomic_load_n(&header->head, __ATOMIC_ACQUIRE);
+}
+
+uint32_t BME680_ShmRing::oldest() const
+{
+	return first(head());
+}
+
+uint32_t BME680_ShmRing::first(uint32_t h) const
+{
+	/*
+	 * Once the ring has filled up, the slot of record h holds record h - capacity (or h while
+	 * it is written). The head alone cannot tell, it may have wrapped around to a small number.
+	 */
+	uint32_t seq = __atomic_load_n(&slots[h % capacity].seq, __ATOMIC_ACQUIRE);
+	bool full = seq && seq != 2 * h + 1 && seq != 2 * h + 2;
+	return full ? h - capacity : 0;
+}
+
+const bme680_record *BME680_ShmRing::acquire(uint32_t &cursor) const
+{
+	for (;;)
+	{
+		uint32_t h = head();
+		if (cursor == h)
+			return 0;
+		uint32_t oldest = first(h);
+		/*
+		 * Lost records, or a cursor ahead of the writer because the ring was initialized
+		 * again: continue with the oldest record that is still complete
+		 */
+		if ((int32_t)(h - cursor) < 0 || h - cursor > capacity)
+			cursor = oldest;
+		const Slot &slot = slots[cursor % capacity];
+		if (__atomic_load_n(&slot.seq, __ATOMIC_ACQUIRE) == 2 * cursor + 2)
+			return &slot.record;
+		if (h - oldest < capacity)
+		{
+			/* Nothing was overwritten, the ring was initialized again under the reader */
+			if (cursor == oldest)
+				return 0;
+			cursor = oldest;
+		}
+		else
+			cursor = h - capacity + 1; // the writer is overwriting this slot right now
+	}
+}
+
+bool BME680_ShmRing::release(uint32_t &cursor) const
+{
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	bool intact = __atomic_load_n(&slots[cursor % capacity].seq, __ATOMIC_RELAXED) == 2 * cursor + 2;
+	cursor++;
+	return intact;
+}
+
+bool BME680_ShmRing::read(uint32_t &cursor, bme680_record &record) const
+{
+	for (;;)
+	{
+		const bme680_record *r = acquire(cursor);
+		if (!r)
+			return false;
+		memcpy(&record, r, sizeof(record));
+		if (release(cursor))
+			return true;
+	}
+}
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                               TABLE                                               *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+BME680_ShmTable::BME680_ShmTable()
+	: header(0), entries(0), count(0)
+{
+}
+
+size_t BME680_ShmTable::size(uint32_t sensors)
+{
+	return sizeof(Header) + (size_t)sensors * sizeof(Entry);
+}
+
+bool BME680_ShmTable::attach(void *memory, size_t bytes, bool initialize)
+{
+	header = 0;
+	if (!memory || bytes < sizeof(Header))
+		return false;
+	Header *h = (Header *)memory;
+	if (initialize)
+	{
+		memset(memory, 0, bytes);
+		h->version = BME680_RECORD_VERSION;
+		h->recordSize = BME680_RECORD_SIZE;
+		h->sensors = (uint32_t)((bytes - sizeof(Header)) / sizeof(Entry));
+		__atomic_store_n(&h->magic, MAGIC, __ATOMIC_RELEASE);
+	}
+	if (__atomic_load_n(&h->magic, __ATOMIC_ACQUIRE) != MAGIC || h->version != BME680_RECORD_VERSION
+		|| h->recordSize != BME680_RECORD_SIZE || h->sensors == 0 || size(h->sensors) > bytes)
+		return false;
+	header = h;
+	entries = (Entry *)(h + 1);
+	count = h->sensors;
+	return true;
+}
+
+void BME680_ShmTable::publish(uint32_t index, const bme680_record &record)
+{
+	if (index >= count)
+		return;
+	Entry &entry = entries[index];
+	uint32_t seq = __atomic_load_n(&entry.seq, __ATOMIC_RELAXED);
+	__atomic_store_n(&entry.seq, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	memcpy(&entry.record, &record, sizeof(record));
+	__atomic_store_n(&entry.seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+uint32_t BME680_ShmTable::read(uint32_t index, bme680_record &record) const
+{
+	if (index >= count)
+		return 0;
+	const Entry &entry = entries[index];
+	for (;;)
+	{
+		uint32_t seq = __atomic_load_n(&entry.seq, __ATOMIC_ACQUIRE);
+		if (seq == 0)
+			return 0;
+		if (seq & 1)
+			continue;
+		memcpy(&record, &entry.record, sizeof(record));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&entry.seq, __ATOMIC_RELAXED) == seq)
+			return seq / 2;
+	}
+}
+
+uint32_t BME680_ShmTable::generation(uint32_t index) const
+{
+	return index < count ? __atomic_load_n(&entries[index].seq, __ATOMIC_ACQUIRE) / 2 : 0;
+}
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                             BROADCAST                                             *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+size_t BME680_ShmBroadcast::size(uint32_t sensors, uint32_t capacity)
+{
+	return BME680_ShmTable::size(sensors) + BME680_ShmRing::size(capacity);
+}
+
+bool BME680_ShmBroadcast::attach(void *memory, size_t bytes, uint32_t sensors, bool initialize)
+{
+	size_t split = BME680_ShmTable::size(sensors);
+	if (initialize && split >= bytes)
+		return false;
+	if (!table.attach(memory, initialize ? split : bytes, initialize))
+		return false;
+	split = BME680_ShmTable::size(table.sensors());
+	return ring.attach((uint8_t *)memory + split, bytes - split, initialize);
+}
+
+void BME680_ShmBroadcast::publish(uint32_t index, const bme680_record &record)
+{
+	table.publish(index, record);
+	ring.push(record);
+}
@@ -0,0 +1,183 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Shm.hpp
+ */
+
+#ifndef BME680_SHM_HPP
+#define BME680_SHM_HPP
+
+#include <cinttypes>
+#include <cstddef>
+#include "bme680_record.h"
+
+/*
+ * Shared memory between one acquisition process and any number of readers.
+ * Readers map the segment read-only and never write to it, so they cannot
+ * disturb the writer or each other. Synchronization uses sequence counters
+ * with GCC atomic builtins, no locks and no system calls after setup.
+ */
+
+/* Mapping of a POSIX shared memory object (shm_open/mmap) */
+class BME680_ShmSegment
+{
+public:
+	BME680_ShmSegment();
+	~BME680_ShmSegment();
+
+	/* Create (or resize) and map read/write, for the writer */
+	bool create(const char *name, size_t size);
+	/* Map an existing segment read-only, for readers */
+	bool open(const char *name);
+	void close();
+	/* Remove the name, mappings stay valid until closed */
+	static void unlink(const char *name);
+
+	void *memory() const { return base; }
+	size_t size() const { return length; }
+
+private:
+	BME680_ShmSegment(const BME680_ShmSegment &);
+	BME680_ShmSegment &operator=(const BME680_ShmSegment &);
+
+	void *base;
+	size_t length;
+};
+
+/*
+ * Ring of the last 'capacity' records. The writer never waits for readers; a reader
+ * that falls behind by more than the capacity skips the overwritten records.
+ * Each reader keeps its own cursor (the number of the next record to read).
+ * Record numbers wrap around at 2^32 and are compared in serial arithmetic; the
+ * capacity is a power of two, so record n stays in slot n % capacity across the wrap.
+ */
+class BME680_ShmRing
+{
+public:
+	static const uint32_t MAGIC = 0x52363842; // "B86R"
+
+	BME680_ShmRing();
+
+	/* Bytes needed for a ring of the given capacity (a power of two) */
+	static size_t size(uint32_t capacity);
+	/*
+	 * Use memory (e.g. BME680_ShmSegment::memory()) as ring, initialize it for the writer.
+	 * The capacity is the largest power of two that fits.
+	 */
+	bool attach(void *memory, size_t size, bool initialize);
+
+	/* Writer: append a record */
+	void push(const bme680_record &record);
+	/* Number of records written so far (wraps around at 2^32) */
+	uint32_t head() const;
+	/* Cursor of the oldest record still in the ring, for a reader that wants the history */
+	uint32_t oldest() const;
+
+	/*
+	 * Zero-copy read of record number 'cursor'. Returns null if there is no new record.
+	 * If the record was already overwritten, cursor is moved to the oldest available one.
+	 * The pointer refers to the shared memory: once done with it, call release() which
+	 * tells whether the writer overwrote it in the meantime, and advances the cursor.
+	 */
+	const bme680_record *acquire(uint32_t &cursor) const;
+	bool release(uint32_t &cursor) const;
+	/* Copying read, returns false if there is no new record */
+	bool read(uint32_t &cursor, bme680_record &record) const;
+
+private:
+	uint32_t first(uint32_t head) const;
+
+	struct Header
+	{
+		uint32_t magic;
+		uint16_t version; // BME680_RECORD_VERSION
+		uint16_t recordSize;
+		uint32_t capacity;
+		uint32_t head;
+	};
+	struct Slot
+	{
+		uint32_t seq; // 2 * n + 1 while record n is written, 2 * n + 2 when complete
+		uint32_t reserved;
+		bme680_record record;
+	};
+
+	Header *header;
+	Slot *slots;
+	uint32_t capacity;
+};
+
+/*
+ * Latest record of each sensor, one seqlock protected entry per sensor index.
+ * Readers spin only while the writer copies one record, they never block it.
+ */
+class BME680_ShmTable
+{
+public:
+	static const uint32_t MAGIC = 0x54363842; // "B86T"
+
+	BME680_ShmTable();
+
+	static size_t size(uint32_t sensors);
+	/* Use memory as table; when initializing, the number of sensors follows from size */
+	bool attach(void *memory, size_t size, bool initialize);
+	uint32_t sensors() const { return count; }
+
+	/* Writer: replace the record of a sensor */
+	void publish(uint32_t index, const bme680_record &record);
+	/*
+	 * Consistent copy of the latest record of a sensor. Returns the number of records
+	 * published for it so far (0: none yet, record untouched), which lets a reader
+	 * poll for new data by comparing with the value it got last time.
+	 */
+	uint32_t read(uint32_t index, bme680_record &record) const;
+	/* Number of records published for a sensor, without copying */
+	uint32_t generation(uint32_t index) const;
+
+private:
+	struct Header
+	{
+		uint32_t magic;
+		uint16_t version; // BME680_RECORD_VERSION
+		uint16_t recordSize;
+		uint32_t sensors;
+		uint32_t reserved;
+	};
+	struct Entry
+	{
+		uint32_t seq; // odd while the record is written, 2 * generation when complete
+		uint32_t reserved;
+		bme680_record record;
+	};
+
+	Header *header;
+	Entry *entries;
+	uint32_t count;
+};
+
+/*
+ * One segment with the latest value table followed by a history ring, so readers
+ * get both the current value of every sensor and the records they missed.
+ */
+class BME680_ShmBroadcast
+{
+public:
+	static size_t size(uint32_t sensors, uint32_t capacity);
+	/* Readers pass sensors = 0, the layout is read from the segment */
+	bool attach(void *memory, size_t size, uint32_t sensors, bool initialize);
+
+	/* Writer: update the table entry of the sensor and append to the history */
+	void publish(uint32_t index, const bme680_record &record);
+
+	const BME680_ShmTable &latest() const { return table; }
+	const BME680_ShmRing &history() const { return ring; }
+
+private:
+	BME680_ShmTable table;
+	BME680_ShmRing ring;
+};
+
+#endif
@@ -0,0 +1,186 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Simulator.cpp
+ */
+
+#include <cstring>
+#include "BME680_Simulator.hpp"
+#include "BME680_Registers.hpp"
+#include "BME680_Calibration.hpp"
+#include "BME680_Timing.hpp"
+
+/* Calibration of a typical device (par_t1 = 26179, par_p1 = 36374, par_h1 = 758, res_heat_range = 1, ...) */
+static const uint8_t BME680_SIM_COEFF1[BME680_Calibration::COEFF1_SIZE] =
+{
+	0x00, 0x83, 0x66, 0x03, 0x00, 0x16, 0x8e, 0x57, 0xd7, 0x58, 0x00, 0xb9, 0x1b, 0x85, 0xff, 0x3d,
+	0x1e, 0x00, 0x00, 0x2d, 0xfa, 0xb9, 0xf3, 0x1e, 0x00
+};
+static const uint8_t BME680_SIM_COEFF2[BME680_Calibration::COEFF2_SIZE] =
+{
+	0x3f, 0x16, 0x2f, 0x00, 0x2d, 0x14, 0x78, 0x9c, 0x43, 0x66, 0xaf, 0xe8, 0xe2, 0x12, 0x00, 0x00
+};
+static const uint8_t BME680_SIM_HEAT[BME680_Calibration::HEAT_SIZE] = { 0x31, 0x00, 0x10, 0x00, 0x00 };
+
+BME680_Simulator::BME680_Simulator()
+	: transactions(0), conversions(0), conversionTime(0), heaterTime(0),
+	  now(0), end(0), running(false), runningGas(false), stable(false),
+	  rawTemp(498766), rawPress(346185), rawHum(21776), rawGas(512), rawGasRange(5), settle(20)
+{
+	memset(reg, 0, sizeof(reg));
+	memcpy(reg + BME680_Calibration::COEFF1_ADDRESS, BME680_SIM_COEFF1, sizeof(BME680_SIM_COEFF1));
+	memcpy(reg + BME680_Calibration::COEFF2_ADDRESS, BME680_SIM_COEFF2, sizeof(BME680_SIM_COEFF2));
+	memcpy(reg + BME680_Calibration::HEAT_ADDRESS, BME680_SIM_HEAT, sizeof(BME680_SIM_HEAT));
+	reset();
+}
+
+void BME680_Simulator::reset()
+{
+	for (uint8_t i = 0; i < BME680_registerCount; i++)
+		reg[BME680_registers[i].address] = BME680_defaultValue(&BME680_registers[i]);
+	running = false;
+}
+
+void BME680_Simulator::setRaw(uint32_t temp, uint32_t press, uint16_t hum, uint16_t gas, uint8_t gasRange)
+{
+	rawTemp = temp & 0xfffff;
+	rawPress = press & 0xfffff;
+	rawHum = hum;
+	rawGas = gas & 0x3ff;
+	rawGasRange = gasRange & gas_r_lsb::gas_range_r::mask;
+}
+
+void BME680_Simulator::setHeaterSettleTime(uint32_t ms)
+{
+	settle = ms;
+}
+
+void BME680_Simulator::setCalibration(uint16_t address, uint8_t value)
+{
+	reg[address & 0xff] = value;
+}
+
+uint64_t BME680_Simulator::micros()
+{
+	return now;
+}
+
+void BME680_Simulator::sleep(uint32_t us)
+{
+	now += us;
+	update();
+}
+
+uint8_t BME680_Simulator::read8(uint16_t address, uint16_t n)
+{
+	(void)n;
+	transactions++;
+	update();
+	return address == RESET::__address ? 0 : reg[address & 0xff];
+}
+
+void BME680_Simulator::write(uint16_t address, uint8_t value, uint16_t n)
+{
+	(void)n;
+	transactions++;
+	update();
+	address &= 0xff;
+	if (address == RESET::__address)
+	{
+		if (value == RESET::Reset::RESET)
+			reset();
+		return;
+	}
+	const BME680_RegisterInfo *info = BME680_findRegister(address);
+	if (!info || !(info->access & BME680_Access::WRITE))
+		return;
+	/* Configuration registers are locked while a conversion is running */
+	if (running)
+		return;
+	reg[address] = value;
+	if (address == Ctrl_meas::__address && (value & Ctrl_meas::mode::mask) == Ctrl_meas::mode::FORCED)
+		start();
+}
+
+void BME680_Simulator::readBurst(uint16_t address, uint8_t *data, uint16_t count)
+{
+	transactions++;
+	update();
+	for (uint16_t i = 0; i < count; i++)
+		data[i] = ((address + i) & 0xff) == RESET::__address ? 0 : reg[(address + i) & 0xff];
+}
+
+void BME680_Simulator::writeBurst(uint16_t address, const uint8_t *data, uint16_t count)
+{
+	uint32_t before = transactions;
+	for (uint16_t i = 0; i < count; i++)
+		write(address + i, data[i], 8);
+	transactions = before + 1;
+}
+
+void BME680_Simulator::start()
+{
+	uint8_t meas = reg[Ctrl_meas::__address];
+	uint8_t osrs_t = (meas & Ctrl_meas::osrs_t::mask) >> 5;
+	uint8_t osrs_p = (meas & Ctrl_meas::osrs_p::mask) >> 2;
+	uint8_t osrs_h = reg[Ctrl_hum::__address] & Ctrl_hum::osrs_h::mask;
+	uint8_t step = reg[Ctrl_gas_1::__address] & Ctrl_gas_1::nb_conv::mask;
+	runningGas = (reg[Ctrl_gas_1::__address] & Ctrl_gas_1::run_gas::mask) != 0;
+	bool heater = runningGas && !(reg[Ctrl_gas_0::__address] & Ctrl_gas_0::heat_off::mask) && step < 10;
+
+	uint32_t wait = heater ? BME680_Timing::gasWait(reg[Gas_wait_0::__address + step]) * 1000 : 0;
+	uint32_t duration = BME680_Timing::tphg(osrs_t, osrs_p, osrs_h, runningGas) + wait;
+	stable = heater && reg[Res_heat_0::__address + step] != 0 && wait >= settle * 1000;
+
+	end = now + duration;
+	running = true;
+	conversionTime += duration;
+	if (heater)
+		heaterTime += wait + BME680_Timing::GAS_US;
+
+	reg[meas_status_0::__address] = (uint8_t)(meas_status_0::measuring::mask
+		| (runningGas ? meas_status_0::gas_measuring::mask : 0)
+		| (reg[meas_status_0::__address] & meas_status_0::gas_meas_index_0::mask));
+}
+
+void BME680_Simulator::update()
+{
+	if (!running || now < end)
+		return;
+	running = false;
+	conversions++;
+
+	uint8_t meas = reg[Ctrl_meas::__address];
+	bool t = (meas & Ctrl_meas::osrs_t::mask) != 0;
+	bool p = (meas & Ctrl_meas::osrs_p::mask) != 0;
+	bool h = (reg[Ctrl_hum::__address] & Ctrl_hum::osrs_h::mask) != 0;
+	uint8_t step = reg[Ctrl_gas_1::__address] & Ctrl_gas_1::nb_conv::mask;
+
+	/* Skipped channels read 0x80000 (T, P) and 0x8000 (H) */
+	uint32_t temp = t ? rawTemp : 0x80000;
+	uint32_t press = p ? rawPress : 0x80000;
+	uint16_t hum = h ? rawHum : 0x8000;
+	reg[press_msb::__address] = (uint8_t)(press >> 12);
+	reg[press_lsb::__address] = (uint8_t)(press >> 4);
+	reg[press_xlsb::__address] = (uint8_t)(press << 4);
+	reg[temp_msb::__address] = (uint8_t)(temp >> 12);
+	reg[temp_lsb::__address] = (uint8_t)(temp >> 4);
+	reg[temp_xlsb::__address] = (uint8_t)(temp << 4);
+	reg[hum_msb::__address] = (uint8_t)(hum >> 8);
+	reg[hum_lsb::__address] = (uint8_t)hum;
+	if (runningGas)
+	{
+		reg[gas_r_msb::__address] = (uint8_t)(rawGas >> 2);
+		reg[gas_r_lsb::__address] = (uint8_t)((rawGas << 6) | gas_r_lsb::gas_valid_r::mask
+			| (stable ? gas_r_lsb::heat_stab_r::mask : 0) | rawGasRange);
+	}
+	else
+		reg[gas_r_lsb::__address] &= (uint8_t)~(gas_r_lsb::gas_valid_r::mask | gas_r_lsb::heat_stab_r::mask);
+
+	reg[meas_status_0::__address] = (uint8_t)(meas_status_0::new_data_0::mask
+		| (runningGas ? step : (reg[meas_status_0::__address] & meas_status_0::gas_meas_index_0::mask)));
+	reg[Ctrl_meas::__address] = (uint8_t)(meas & ~Ctrl_meas::mode::mask);
+}
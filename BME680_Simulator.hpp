@@ -0,0 +1,74 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Simulator.hpp
+ */
+
+#ifndef BME680_SIMULATOR_HPP
+#define BME680_SIMULATOR_HPP
+
+#include <cinttypes>
+#include "BME680.hpp"
+#include "BME680_Clock.hpp"
+
+/*
+ * Register level BME680 model running on a virtual clock, for testing without hardware.
+ * Writing FORCED to Ctrl_meas starts a TPHG cycle which takes the datasheet conversion
+ * time plus the heater wait of the selected step; results appear in the data registers
+ * when the virtual time (advanced by sleep()) has passed the end of the cycle.
+ * The device holds a plausible calibration; the raw ADC values are set by the test.
+ */
+class BME680_Simulator : public BME680_Base, public BME680_Clock
+{
+public:
+	BME680_Simulator();
+
+	/* BME680_Base */
+	uint8_t read8(uint16_t address, uint16_t n=8);
+	void write(uint16_t address, uint8_t value, uint16_t n=8);
+	void readBurst(uint16_t address, uint8_t *data, uint16_t count);
+	void writeBurst(uint16_t address, const uint8_t *data, uint16_t count);
+
+	/* BME680_Clock, sleep advances the virtual time */
+	uint64_t micros();
+	void sleep(uint32_t us);
+
+	/* Reset all registers except the calibration, like a power-on or soft reset */
+	void reset();
+
+	/* Raw ADC values reported by the next conversions (20 bit T/P, 16 bit H, 10 bit gas) */
+	void setRaw(uint32_t temp, uint32_t press, uint16_t hum, uint16_t gas, uint8_t gasRange);
+	/* Heater wait needed for heat_stab_r = 1, in ms */
+	void setHeaterSettleTime(uint32_t ms);
+	/* Overwrite a calibration register, e.g. to simulate a different device */
+	void setCalibration(uint16_t address, uint8_t value);
+
+	/* Counters of the simulated device */
+	uint32_t transactions; // bus transactions, a burst counts once
+	uint32_t conversions; // completed TPHG cycles
+	uint64_t conversionTime; // us spent converting
+	uint64_t heaterTime; // us with the heater on
+
+private:
+	void update(); // complete a running conversion once its time has passed
+	void start(); // start a forced mode conversion
+
+	uint8_t reg[256];
+	uint64_t now;
+	uint64_t end;
+	bool running;
+	bool runningGas;
+	bool stable;
+
+	uint32_t rawTemp;
+	uint32_t rawPress;
+	uint16_t rawHum;
+	uint16_t rawGas;
+	uint8_t rawGasRange;
+	uint32_t settle;
+};
+
+#endif
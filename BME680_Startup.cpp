@@ -0,0 +1,193 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Startup.cpp
+ */
+
+#include <cstdio>
+#include <cstring>
+#include "BME680.hpp"
+#include "BME680_GasWaitTuner.hpp"
+#include "BME680_Startup.hpp"
+
+static const char BME680_CACHE_MAGIC[8] = { 'B', 'M', 'E', '6', '8', '0', 'C', '1' };
+static const char BME680_PROFILE_MAGIC[8] = { 'B', 'M', 'E', '6', '8', '0', 'W', '1' };
+static const size_t BME680_MAGIC_SIZE = sizeof(BME680_CACHE_MAGIC);
+static const size_t BME680_PAYLOAD_MAX = BME680_Calibration::RAW_SIZE > BME680_GasWaitProfile::SIZE
+	? BME680_Calibration::RAW_SIZE : BME680_GasWaitProfile::SIZE;
+
+/* Fletcher-16 */
+static uint16_t checksum(const uint8_t *data, size_t size, uint16_t sum = 0)
+{
+	uint16_t a = sum & 0xff, b = sum >> 8;
+	for (size_t i = 0; i < size; i++)
+	{
+		a = (a + data[i]) % 255;
+		b = (b + a) % 255;
+	}
+	return (uint16_t)((b << 8) | a);
+}
+
+BME680_CalibrationCache::BME680_CalibrationCache(const char *directory)
+	: dir(directory)
+{
+}
+
+bool BME680_CalibrationCache::path(const char *key, const char *suffix, char *buffer, size_t size) const
+{
+	int n = snprintf(buffer, size, "%s/bme680-", dir);
+	if (n < 0 || (size_t)n >= size)
+		return false;
+	size_t i = n;
+	for (const char *c = key; *c; c++)
+	{
+		if (i + 1 >= size - 4)
+			return false;
+		bool plain = (*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z') || (*c >= '0' && *c <= '9');
+		buffer[i++] = plain ? *c : '_';
+	}
+	strcpy(buffer + i, suffix);
+	return true;
+}
+
+/* File layout: magic, key length, key, payload, Fletcher-16 of all before (little endian) */
+bool BME680_CalibrationCache::read(const char *key, const char *suffix, const char *magic, uint8_t *data, size_t payload)
+{
+	char name[256];
+	if (!key || !path(key, suffix, name, sizeof(name)))
+		return false;
+	FILE *f = fopen(name, "rb");
+	if (!f)
+		return false;
+
+	uint8_t buffer[BME680_MAGIC_SIZE + 1 + 255 + BME680_PAYLOAD_MAX + 2];
+	size_t keyLength = strlen(key);
+	size_t size = BME680_MAGIC_SIZE + 1 + keyLength + payload + 2;
+	bool ok = keyLength <= 255 && fread(buffer, 1, sizeof(buffer), f) == size;
+	fclose(f);
+
+	const uint8_t *p = buffer;
+	ok = ok && !memcmp(p, magic, BME680_MAGIC_SIZE);
+	p += BME680_MAGIC_SIZE;
+	ok = ok && *p == keyLength && !memcmp(p + 1, key, keyLength);
+	p += 1 + keyLength;
+	const uint8_t *raw = p;
+	p += payload;
+	ok = ok && checksum(buffer, p - buffer) == (uint16_t)(p[0] | (p[1] << 8));
+	if (!ok)
+		return false;
+
+	memcpy(data, raw, payload);
+	return true;
+}
+
+bool BME680_CalibrationCache::write(const char *key, const char *suffix, const char *magic, const uint8_t *data, size_t payload)
+{
+	char name[256], temp[260];
+	size_t keyLength = key ? strlen(key) : 256;
+	if (keyLength > 255 || !path(key, suffix, name, sizeof(name)))
+		return false;
+
+	uint8_t buffer[BME680_MAGIC_SIZE + 1 + 255 + BME680_PAYLOAD_MAX + 2];
+	uint8_t *p = buffer;
+	memcpy(p, magic, BME680_MAGIC_SIZE);
+	p += BME680_MAGIC_SIZE;
+	*p++ = (uint8_t)keyLength;
+	memcpy(p, key, keyLength);
+	p += keyLength;
+	memcpy(p, data, payload);
+	p += payload;
+	uint16_t sum = checksum(buffer, p - buffer);
+	*p++ = (uint8_t)sum;
+	*p++ = (uint8_t)(sum >> 8);
+
+	/* Write to a temporary file and rename, so readers never see a partial file */
+	snprintf(temp, sizeof(temp), "%s.tmp", name);
+	FILE *f = fopen(temp, "wb");
+	if (!f)
+		return false;
+	bool ok = fwrite(buffer, 1, p - buffer, f) == (size_t)(p - buffer);
+	ok = (fclose(f) == 0) && ok;
+	if (!ok || rename(temp, name) != 0)
+	{
+		remove(temp);
+		return false;
+	}
+	return true;
+}
+
+bool BME680_CalibrationCache::load(const char *key, BME680_Calibration &cal)
+{
+	if (!read(key, ".cal", BME680_CACHE_MAGIC, cal.raw, BME680_Calibration::RAW_SIZE))
+		return false;
+	cal.parse();
+	return true;
+}
+
+bool BME680_CalibrationCache::save(const char *key, const BME680_Calibration &cal)
+{
+	return write(key, ".cal", BME680_CACHE_MAGIC, cal.raw, BME680_Calibration::RAW_SIZE);
+}
+
+bool BME680_CalibrationCache::load(const char *key, BME680_GasWaitProfile &profile)
+{
+	uint8_t data[BME680_GasWaitProfile::SIZE];
+	if (!read(key, ".gw", BME680_PROFILE_MAGIC, data, sizeof(data)) || data[0] > BME680_GasWaitProfile::STEPS)
+		return false;
+	profile.count = data[0];
+	for (uint8_t i = 0; i < BME680_GasWaitProfile::STEPS; i++)
+	{
+		profile.resHeat[i] = data[1 + 2 * i];
+		profile.gasWait[i] = data[2 + 2 * i];
+	}
+	return true;
+}
+
+bool BME680_CalibrationCache::save(const char *key, const BME680_GasWaitProfile &profile)
+{
+	uint8_t data[BME680_GasWaitProfile::SIZE];
+	data[0] = profile.count;
+	for (uint8_t i = 0; i < BME680_GasWaitProfile::STEPS; i++)
+	{
+		data[1 + 2 * i] = profile.resHeat[i];
+		data[2 + 2 * i] = profile.gasWait[i];
+	}
+	return write(key, ".gw", BME680_PROFILE_MAGIC, data, sizeof(data));
+}
+
+uint8_t BME680_start(BME680_Base &dev, const BME680_Base::RegisterDump &expected, BME680_Clock &clock,
+	BME680_Calibration &cal, BME680_CalibrationCache *cache, const char *key)
+{
+	if (dev.getId() != BME680_Base::Id::chip_id::dflt)
+		return BME680_Startup::NO_DEVICE;
+
+	BME680_Base::RegisterDump current;
+	dev.dumpRegisters(current);
+	bool configured = current.sameConfiguration(expected);
+
+	if (configured && cache && cache->load(key, cal))
+	{
+		/* One burst tells whether the cached calibration belongs to this device */
+		uint8_t coeff2[BME680_Calibration::COEFF2_SIZE];
+		dev.readBurst(BME680_Calibration::COEFF2_ADDRESS, coeff2, BME680_Calibration::COEFF2_SIZE);
+		if (!memcmp(coeff2, cal.raw + BME680_Calibration::COEFF1_SIZE, BME680_Calibration::COEFF2_SIZE))
+			return BME680_Startup::FAST;
+	}
+
+	if (!configured)
+	{
+		dev.setRESET(BME680_Base::RESET::Reset::RESET);
+		clock.sleep(BME680_Startup::RESET_PERIOD_US);
+	}
+	cal.read(dev);
+	if (cache)
+		cache->save(key, cal);
+	if (configured)
+		return BME680_Startup::CALIBRATED;
+
+	dev.restoreRegisters(expected);
+	return BME680_Startup::FULL;
+}
@@ -0,0 +1,68 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Startup.hpp
+ */
+
+#ifndef BME680_STARTUP_HPP
+#define BME680_STARTUP_HPP
+
+#include <cinttypes>
+#include <cstddef>
+#include "BME680_Core.hpp"
+#include "BME680_Calibration.hpp"
+#include "BME680_Clock.hpp"
+
+struct BME680_GasWaitProfile;
+
+/*
+ * Calibration cache on disk, one file per device in the given directory.
+ * The key identifies the device, e.g. "i2c-1:0x76". Files carry the full key
+ * and a checksum, a damaged or foreign file is treated as a miss.
+ * The tuned heater profile of a device (BME680_GasWaitTuner) is kept next to it.
+ */
+class BME680_CalibrationCache
+{
+public:
+	BME680_CalibrationCache(const char *directory);
+
+	bool load(const char *key, BME680_Calibration &cal);
+	bool save(const char *key, const BME680_Calibration &cal);
+	bool load(const char *key, BME680_GasWaitProfile &profile);
+	bool save(const char *key, const BME680_GasWaitProfile &profile);
+
+private:
+	bool path(const char *key, const char *suffix, char *buffer, size_t size) const;
+	bool read(const char *key, const char *suffix, const char *magic, uint8_t *data, size_t size);
+	bool write(const char *key, const char *suffix, const char *magic, const uint8_t *data, size_t size);
+
+	const char *dir;
+};
+
+/* Result of BME680_start */
+struct BME680_Startup
+{
+	static const uint8_t FAST = 0; // configuration found on the device, calibration from cache
+	static const uint8_t CALIBRATED = 1; // configuration found on the device, calibration read
+	static const uint8_t FULL = 2; // soft reset, calibration read and configuration written
+	static const uint8_t NO_DEVICE = 3; // Id::chip_id does not match
+
+	static const uint32_t RESET_PERIOD_US = 10000; // wait after a soft reset
+};
+
+/*
+ * Bring a device into the 'expected' configuration (a RegisterDump, e.g. saved after a
+ * first full setup) as fast as possible:
+ * 1. check Id::chip_id
+ * 2. burst read the configuration registers and compare them with 'expected'
+ * 3. take the calibration from the cache if one burst of the device calibration matches it
+ * Only when the configuration differs the device is reset and fully reprogrammed.
+ * The cache may be null. Returns one of the BME680_Startup constants.
+ */
+uint8_t BME680_start(BME680_Base &dev, const BME680_RegisterDump &expected, BME680_Clock &clock,
+	BME680_Calibration &cal, BME680_CalibrationCache *cache = 0, const char *key = 0);
+
+#endif
@@ -0,0 +1,239 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_StaticConfig.hpp
+ */
+
+#ifndef BME680_STATICCONFIG_HPP
+#define BME680_STATICCONFIG_HPP
+
+#include <cinttypes>
+#include "BME680.hpp"
+#include "BME680_Timing.hpp"
+
+/*
+ * Fixed configuration described by types, with all register values and the measurement
+ * duration computed by the compiler from the mask and enumeration constants of BME680_Base:
+ *
+ *   typedef BME680_Base B;
+ *   typedef BME680_StaticConfig<
+ *       BME680_Osrs_t<B::Ctrl_meas::osrs_t::X2>,
+ *       BME680_Osrs_p<B::Ctrl_meas::osrs_p::X16>,
+ *       BME680_Osrs_h<B::Ctrl_hum::osrs_h::X1>,
+ *       BME680_Filter<3>,
+ *       BME680_Heater<0, 150> > Config;  // heater step 0, 150 ms
+ *
+ *   BME680_applyConfig<Config>(dev, resHeat);  // constant table of register writes
+ *   uint32_t us = Config::duration;
+ *
+ * Options that are not given keep their defaults (X1 oversampling, no filter, no gas).
+ * Invalid values and combinations fail to compile. The heater resistance depends on the
+ * calibration and the ambient temperature and is passed at runtime.
+ */
+
+/* Compile-time assertion, the array size is negative if the condition is false */
+#define BME680_STATIC_ASSERT(condition, name) typedef char name[(condition) ? 1 : -1]
+
+/* Settings before any option is applied */
+struct BME680_ConfigDefaults
+{
+	static const uint8_t osrs_t = BME680_Base::Ctrl_meas::osrs_t::X1;
+	static const uint8_t osrs_p = BME680_Base::Ctrl_meas::osrs_p::X1;
+	static const uint8_t osrs_h = BME680_Base::Ctrl_hum::osrs_h::X1;
+	static const uint8_t filter = BME680_Base::Config::filter::dflt;
+	static const bool gas = false;
+	static const uint8_t step = 0;
+	static const uint32_t gasWaitMs = 0;
+
+	/* Number of options given for each setting, at most one is allowed */
+	static const uint8_t osrs_t_count = 0;
+	static const uint8_t osrs_p_count = 0;
+	static const uint8_t osrs_h_count = 0;
+	static const uint8_t filter_count = 0;
+	static const uint8_t gas_count = 0;
+};
+
+/* Placeholder for an unused option */
+struct BME680_NoOption
+{
+	template <class B> struct apply : B {};
+};
+
+template <uint8_t OSRS>
+struct BME680_Osrs_t
+{
+	BME680_STATIC_ASSERT(OSRS <= BME680_Base::Ctrl_meas::osrs_t::X16, osrs_t_is_SKIPPED_to_X16);
+	template <class B> struct apply : B
+	{
+		static const uint8_t osrs_t = OSRS;
+		static const uint8_t osrs_t_count = B::osrs_t_count + 1;
+	};
+};
+
+template <uint8_t OSRS>
+struct BME680_Osrs_p
+{
+	BME680_STATIC_ASSERT(OSRS <= BME680_Base::Ctrl_meas::osrs_p::X16, osrs_p_is_SKIPPED_to_X16);
+	template <class B> struct apply : B
+	{
+		static const uint8_t osrs_p = OSRS;
+		static const uint8_t osrs_p_count = B::osrs_p_count + 1;
+	};
+};
+
+template <uint8_t OSRS>
+struct BME680_Osrs_h
+{
+	BME680_STATIC_ASSERT(OSRS <= BME680_Base::Ctrl_hum::osrs_h::X16, osrs_h_is_SKIPPED_to_X16);
+	template <class B> struct apply : B
+	{
+		static const uint8_t osrs_h = OSRS;
+		static const uint8_t osrs_h_count = B::osrs_h_count + 1;
+	};
+};
+
+/* IIR filter code (Config::filter), 0 = off .. 7 = coefficient 127 */
+template <uint8_t COEFFICIENT>
+struct BME680_Filter
+{
+	BME680_STATIC_ASSERT(COEFFICIENT <= (BME680_Base::Config::filter::mask >> 2), filter_is_0_to_7);
+	template <class B> struct apply : B
+	{
+		static const uint8_t filter = COEFFICIENT;
+		static const uint8_t filter_count = B::filter_count + 1;
+	};
+};
+
+/* Gas conversion with heater set-point STEP (nb_conv, 0..9) and a heater wait of WAIT_MS (1..4032) */
+template <uint8_t STEP, uint32_t WAIT_MS>
+struct BME680_Heater
+{
+	BME680_STATIC_ASSERT(STEP <= 9, heater_step_is_0_to_9);
+	BME680_STATIC_ASSERT(WAIT_MS > 0 && WAIT_MS <= 0x3f * 64, heater_wait_is_1_to_4032_ms);
+	template <class B> struct apply : B
+	{
+		static const bool gas = true;
+		static const uint8_t step = STEP;
+		static const uint32_t gasWaitMs = WAIT_MS;
+		static const uint8_t gas_count = B::gas_count + 1;
+	};
+};
+
+/* Heater off, no gas conversion (the default) */
+struct BME680_NoGas
+{
+	template <class B> struct apply : B
+	{
+		static const bool gas = false;
+		static const uint8_t gas_count = B::gas_count + 1;
+	};
+};
+
+/* Oversampling factor of an osrs_x code, see BME680_Timing::factor */
+template <uint8_t OSRS>
+struct BME680_OsrsFactor
+{
+	static const uint8_t value = (uint8_t)((1 << OSRS) >> 1);
+};
+
+/* Gas_wait_x value for a wait of at least MS, same rounding as BME680_Timing::gasWaitCode */
+template <uint32_t MS, uint8_t MULT = 0, bool FITS = (MS <= BME680_Base::Gas_wait_0::gas_wait_val::mask)>
+struct BME680_GasWaitCode
+{
+	static const uint8_t value = BME680_GasWaitCode<(MS + 3) / 4, MULT + 1>::value;
+};
+
+template <uint32_t MS, uint8_t MULT>
+struct BME680_GasWaitCode<MS, MULT, true>
+{
+	static const uint8_t value = (uint8_t)((MULT << 6) | MS);
+};
+
+template <class O, class B>
+struct BME680_ApplyOption
+{
+	typedef typename O::template apply<B> type;
+};
+
+template <class O1 = BME680_NoOption, class O2 = BME680_NoOption, class O3 = BME680_NoOption,
+	class O4 = BME680_NoOption, class O5 = BME680_NoOption, class O6 = BME680_NoOption>
+struct BME680_StaticConfig
+{
+	typedef BME680_Base B;
+	typedef typename BME680_ApplyOption<O1, BME680_ConfigDefaults>::type S1;
+	typedef typename BME680_ApplyOption<O2, S1>::type S2;
+	typedef typename BME680_ApplyOption<O3, S2>::type S3;
+	typedef typename BME680_ApplyOption<O4, S3>::type S4;
+	typedef typename BME680_ApplyOption<O5, S4>::type S5;
+	typedef typename BME680_ApplyOption<O6, S5>::type Settings;
+
+	BME680_STATIC_ASSERT(Settings::osrs_t_count <= 1, osrs_t_given_twice);
+	BME680_STATIC_ASSERT(Settings::osrs_p_count <= 1, osrs_p_given_twice);
+	BME680_STATIC_ASSERT(Settings::osrs_h_count <= 1, osrs_h_given_twice);
+	BME680_STATIC_ASSERT(Settings::filter_count <= 1, filter_given_twice);
+	BME680_STATIC_ASSERT(Settings::gas_count <= 1, heater_given_twice);
+	BME680_STATIC_ASSERT(Settings::osrs_t || Settings::osrs_p || Settings::osrs_h || Settings::gas, nothing_to_measure);
+	/* Pressure and humidity compensation need the temperature of the same measurement */
+	BME680_STATIC_ASSERT(Settings::osrs_t || (!Settings::osrs_p && !Settings::osrs_h), pressure_and_humidity_need_temperature);
+
+	static const uint8_t osrs_t = Settings::osrs_t;
+	static const uint8_t osrs_p = Settings::osrs_p;
+	static const uint8_t osrs_h = Settings::osrs_h;
+	static const bool gas = Settings::gas;
+	static const uint8_t step = Settings::step;
+
+	/* Register values */
+	static const uint8_t ctrl_hum = (uint8_t)(osrs_h & B::Ctrl_hum::osrs_h::mask);
+	static const uint8_t ctrl_meas = (uint8_t)(((osrs_t << 5) & B::Ctrl_meas::osrs_t::mask)
+		| ((osrs_p << 2) & B::Ctrl_meas::osrs_p::mask) | B::Ctrl_meas::mode::SLEEP);
+	static const uint8_t ctrl_meas_forced = (uint8_t)(ctrl_meas | B::Ctrl_meas::mode::FORCED);
+	static const uint8_t config = (uint8_t)((Settings::filter << 2) & B::Config::filter::mask);
+	static const uint8_t ctrl_gas_0 = gas ? 0 : B::Ctrl_gas_0::heat_off::mask;
+	static const uint8_t ctrl_gas_1 = gas ? (uint8_t)(B::Ctrl_gas_1::run_gas::mask | (step & B::Ctrl_gas_1::nb_conv::mask)) : 0;
+	static const uint8_t gas_wait = BME680_GasWaitCode<Settings::gasWaitMs>::value;
+	static const uint16_t gas_wait_address = B::Gas_wait_0::__address + step;
+	static const uint16_t res_heat_address = B::Res_heat_0::__address + step;
+
+	/* Heater wait as encoded (rounded up), in ms */
+	static const uint32_t gasWaitMs = (uint32_t)(gas_wait & B::Gas_wait_0::gas_wait_val::mask) << (2 * (gas_wait >> 6));
+	/* Duration of a forced mode measurement in us, as BME680_Timing::tphg plus the heater wait */
+	static const uint32_t duration = (uint32_t)(BME680_OsrsFactor<osrs_t>::value + BME680_OsrsFactor<osrs_p>::value
+		+ BME680_OsrsFactor<osrs_h>::value) * BME680_Timing::CYCLE_US + BME680_Timing::SWITCH_US + BME680_Timing::WAKEUP_US
+		+ (gas ? BME680_Timing::GAS_US + gasWaitMs * 1000 : 0);
+};
+
+/* Register write of a constant initialization table */
+struct BME680_RegisterWrite
+{
+	uint8_t address;
+	uint8_t value;
+};
+
+/*
+ * Write the configuration (device in sleep mode), heater resistance resHeat for the gas
+ * step (see BME680_Compensation::heaterResistance). Start a measurement with
+ * dev.setCtrl_meas(C::ctrl_meas_forced).
+ */
+template <class C>
+void BME680_applyConfig(BME680_Base &dev, uint8_t resHeat = 0)
+{
+	typedef BME680_Base B;
+	static const BME680_RegisterWrite writes[] =
+	{
+		{ B::Ctrl_meas::__address, C::ctrl_meas }, // sleep first, writes in other modes are ignored
+		{ B::Ctrl_hum::__address, C::ctrl_hum },
+		{ B::Config::__address, C::config },
+		{ B::Ctrl_gas_0::__address, C::ctrl_gas_0 },
+		{ B::Ctrl_gas_1::__address, C::ctrl_gas_1 },
+		{ C::gas_wait_address, C::gas_wait },
+	};
+	for (uint8_t i = 0; i < (C::gas ? 6 : 5); i++)
+		dev.write(writes[i].address, writes[i].value, 8);
+	if (C::gas)
+		dev.write(C::res_heat_address, resHeat, 8);
+}
+
+#endif
@@ -0,0 +1,263 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Stats.cpp
+ */
+
+#include <cmath>
+#include "BME680_Stats.hpp"
+
+/***************************************************************************************************\
+ *                                                                                                 *
+ *                                          RUNNING STATS                                          *
+ *                                                                                                 *
+\***************************************************************************************************/
+
+BME680_RunningStats::BME680_RunningStats()
+{
+	reset();
+}
+
+void BME680_RunningStats::reset()
+{
+	n = 0;
+	m = 0.0;
+	m2 = 0.0;
+	lo = 0.0;
+	hi = 0.0;
+}
+
+void BME680_RunningStats::add(double x)
+{
+	n++;
+	double delta = x - m;
+	m += delta / n;
+	m2 += delta * (x - m);
+	if (n == 1 || x < lo)
+		lo = x;
+	if (n == 1 || x > hi)
+		hi = x;
+}
+
+void BME680_RunningStats::merge(const BME680_RunningStats &other)
+{
+	if (other.n == 0)
+		return;
+	if (n == 0)
+	{
+		*this = other;
+		return;
+	}
+	double na = n, nb = other.n, nt = na + nb;
+	double delta = other.m - m;
+	m += delta * nb / nt;
+	m2 += other.m2 + delta * delta * na * nb / nt;
+	n += other.n;
+	if (other.lo < lo)
+		lo = other.lo;
+	if (other.hi > hi)
+		hi = other.hi;
+}
+
+double BME680_RunningStats::variance() const
+{
+	return n > 1 ? m2 / (n - 1) : 0.0;
+}
+
+double BME680_RunningStats::stddev() const
+{
+	return std::sqrt(variance());
+}
+
+/***************************************************************************************************\
+ *                                                                                                 *
+ *                                            HISTOGRAM                                            *
+ *                                                                                                 *
+\***************************************************************************************************/
+
+BME680_Histogram::BME680_Histogram()
+{
+	setRange(BME680_Range());
+}
+
+void BME680_Histogram::setRange(const BME680_Range &range)
+{
+	r = range;
+	double lo = r.logarithmic ? std::log(r.lo) : r.lo;
+	double hi = r.logarithmic ? std::log(r.hi) : r.hi;
+	scale = hi > lo ? BINS / (hi - lo) : 0.0;
+	reset();
+}
+
+void BME680_Histogram::reset()
+{
+	n = 0;
+	for (uint16_t i = 0; i < BINS; i++)
+		bins[i] = 0;
+}
+
+double BME680_Histogram::position(double x) const
+{
+	if (r.logarithmic)
+		return x > 0.0 ? (std::log(x) - std::log(r.lo)) * scale : 0.0;
+	return (x - r.lo) * scale;
+}
+
+double BME680_Histogram::value(double pos) const
+{
+	if (scale == 0.0)
+		return r.lo;
+	if (r.logarithmic)
+		return std::exp(std::log(r.lo) + pos / scale);
+	return r.lo + pos / scale;
+}
+
+void BME680_Histogram::add(double x)
+{
+	double pos = position(x);
+	uint16_t i = pos <= 0.0 ? 0 : pos >= BINS ? BINS - 1 : (uint16_t)pos;
+	bins[i]++;
+	n++;
+}
+
+void BME680_Histogram::merge(const BME680_Histogram &other)
+{
+	for (uint16_t i = 0; i < BINS; i++)
+		bins[i] += other.bins[i];
+	n += other.n;
+}
+
+double BME680_Histogram::quantile(double q) const
+{
+	if (n == 0)
+		return 0.0;
+	if (q < 0.0)
+		q = 0.0;
+	if (q > 1.0)
+		q = 1.0;
+	double target = q * n;
+	uint32_t cumulated = 0;
+	for (uint16_t i = 0; i < BINS; i++)
+	{
+		if (bins[i] && cumulated + bins[i] >= target)
+			return value(i + (target - cumulated) / bins[i]);
+		cumulated += bins[i];
+	}
+	return value(BINS);
+}
+
+/***************************************************************************************************\
+ *                                                                                                 *
+ *                                          CHANNEL STATS                                          *
+ *                                                                                                 *
+\***************************************************************************************************/
+
+void BME680_ChannelStats::reset()
+{
+	moments.reset();
+	sketch.reset();
+}
+
+void BME680_ChannelStats::add(double x)
+{
+	moments.add(x);
+	sketch.add(x);
+}
+
+void BME680_ChannelStats::merge(const BME680_ChannelStats &other)
+{
+	moments.merge(other.moments);
+	sketch.merge(other.sketch);
+}
+
+double BME680_ChannelStats::quantile(double q) const
+{
+	if (moments.count() == 0)
+		return 0.0;
+	double x = sketch.quantile(q);
+	if (x < moments.minimum())
+		return moments.minimum();
+	if (x > moments.maximum())
+		return moments.maximum();
+	return x;
+}
+
+BME680_StatsConfig::BME680_StatsConfig()
+{
+	range[BME680_Channel::TEMPERATURE] = BME680_Range(-40.0, 85.0);
+	range[BME680_Channel::PRESSURE] = BME680_Range(30000.0, 110000.0);
+	range[BME680_Channel::HUMIDITY] = BME680_Range(0.0, 100.0);
+	range[BME680_Channel::GAS] = BME680_Range(50.0, 50000000.0, true);
+}
+
+/***************************************************************************************************\
+ *                                                                                                 *
+ *                                             WINDOWS                                             *
+ *                                                                                                 *
+\***************************************************************************************************/
+
+void BME680_WindowStats::setup(const BME680_StatsConfig &config)
+{
+	for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+		channel[c].sketch.setRange(config.range[c]);
+	reset(0);
+	length = 0;
+}
+
+void BME680_WindowStats::reset(uint32_t windowStart)
+{
+	start = windowStart;
+	for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+		channel[c].reset();
+}
+
+void BME680_WindowStats::add(const BME680_Sample &sample)
+{
+	for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+		if (sample.isValid(c))
+			channel[c].add(sample.value[c]);
+}
+
+void BME680_WindowStats::merge(const BME680_WindowStats &other)
+{
+	for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+		channel[c].merge(other.channel[c]);
+}
+
+BME680_TumblingAggregator::BME680_TumblingAggregator(uint32_t windowLength, const BME680_StatsConfig &config)
+	: closed(0), length(windowLength ? windowLength : 1), started(false)
+{
+	window.setup(config);
+	window.length = length;
+	last.setup(config);
+	last.length = length;
+}
+
+bool BME680_TumblingAggregator::add(const BME680_Sample &sample, BME680_WindowStats *completed)
+{
+	uint32_t start = sample.timestamp - sample.timestamp % length;
+	bool closed = false;
+	if (!started)
+	{
+		window.reset(start);
+		started = true;
+	}
+	else if (start != window.start)
+	{
+		if (completed)
+			*completed = window;
+		window.reset(start);
+		closed = true;
+	}
+	window.add(sample);
+	return closed;
+}
+
+void BME680_TumblingAggregator::add(const BME680_Sample &sample)
+{
+	if (add(sample, &last))
+		closed++;
+}
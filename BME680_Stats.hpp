@@ -0,0 +1,243 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Stats.hpp
+ */
+
+#ifndef BME680_STATS_HPP
+#define BME680_STATS_HPP
+
+#include <cinttypes>
+#include "BME680_Sample.hpp"
+
+/*
+ * Streaming aggregation of compensated samples in constant memory.
+ * Samples are added one by one as they come out of the measurement cycle,
+ * no raw sample is ever stored.
+ */
+
+/* Count, min, max, mean and variance of a stream (Welford's algorithm) */
+class BME680_RunningStats
+{
+public:
+	BME680_RunningStats();
+
+	void reset();
+	void add(double x);
+	/* Combine with the statistics of a disjoint part of the stream (Chan et al.) */
+	void merge(const BME680_RunningStats &other);
+
+	uint32_t count() const { return n; }
+	double mean() const { return m; }
+	double minimum() const { return lo; }
+	double maximum() const { return hi; }
+	double variance() const; // sample variance, 0 for less than two samples
+	double stddev() const;
+
+private:
+	uint32_t n;
+	double m;
+	double m2;
+	double lo;
+	double hi;
+};
+
+/* Value range covered by the percentile sketch of one channel */
+struct BME680_Range
+{
+	double lo;
+	double hi;
+	bool logarithmic; // bins equally spaced in log(value), for gas resistance
+
+	BME680_Range() : lo(0.0), hi(1.0), logarithmic(false) {}
+	BME680_Range(double l, double h, bool lg = false) : lo(l), hi(h), logarithmic(lg) {}
+};
+
+/*
+ * Fixed size histogram used as mergeable percentile sketch.
+ * Resolution is (hi - lo) / BINS, values outside the range are clamped to the border bins.
+ */
+class BME680_Histogram
+{
+public:
+	static const uint16_t BINS = 128;
+
+	BME680_Histogram();
+
+	void setRange(const BME680_Range &range);
+	void reset();
+	void add(double x);
+	/* Both histograms must have been set up with the same range */
+	void merge(const BME680_Histogram &other);
+
+	uint32_t count() const { return n; }
+	/* Approximate q-quantile (0 <= q <= 1) by linear interpolation within a bin */
+	double quantile(double q) const;
+
+private:
+	double position(double x) const; // value -> fractional bin
+	double value(double pos) const; // fractional bin -> value
+
+	BME680_Range r;
+	double scale; // bins per unit of (possibly logarithmic) value
+	uint32_t n;
+	uint32_t bins[BINS];
+};
+
+/* Statistics of one channel: exact moments and approximate percentiles */
+struct BME680_ChannelStats
+{
+	BME680_RunningStats moments;
+	BME680_Histogram sketch;
+
+	void reset();
+	void add(double x);
+	void merge(const BME680_ChannelStats &other);
+	/* Quantile from the sketch, clamped to the exact min/max */
+	double quantile(double q) const;
+};
+
+/* Histogram ranges of all channels, defaults cover the datasheet operating range */
+struct BME680_StatsConfig
+{
+	BME680_Range range[BME680_Channel::COUNT];
+
+	BME680_StatsConfig();
+};
+
+/* Aggregate of all channels over one window */
+struct BME680_WindowStats
+{
+	uint32_t start; // timestamp of the window start in ms
+	uint32_t length; // window length in ms
+	BME680_ChannelStats channel[BME680_Channel::COUNT];
+
+	void setup(const BME680_StatsConfig &config);
+	void reset(uint32_t windowStart);
+	void add(const BME680_Sample &sample);
+	void merge(const BME680_WindowStats &other);
+};
+
+/* Receiver of the compensated samples of a measurement cycle (BME680_Daemon::setStats) */
+class BME680_SampleSink
+{
+public:
+	virtual ~BME680_SampleSink() {}
+
+	virtual void add(const BME680_Sample &sample) = 0;
+};
+
+/*
+ * Tumbling (non-overlapping) windows aligned to multiples of the window length,
+ * e.g. 60000 for minute aggregates on a millisecond clock.
+ */
+class BME680_TumblingAggregator : public BME680_SampleSink
+{
+public:
+	BME680_TumblingAggregator(uint32_t windowLength, const BME680_StatsConfig &config = BME680_StatsConfig());
+
+	/*
+	 * Add a sample. If the sample belongs to a later window than the current one,
+	 * the current window is closed and copied to *completed (if not null) and true is returned.
+	 */
+	bool add(const BME680_Sample &sample, BME680_WindowStats *completed);
+	/* As a sink: the closed window is kept as previous() */
+	void add(const BME680_Sample &sample);
+	/* Statistics of the still open window */
+	const BME680_WindowStats &current() const { return window; }
+	/* Last closed window, valid once closed is not 0 */
+	const BME680_WindowStats &previous() const { return last; }
+
+	uint32_t closed; // windows closed so far
+
+private:
+	uint32_t length;
+	bool started;
+	BME680_WindowStats window;
+	BME680_WindowStats last;
+};
+
+/*
+ * Sliding window of the given length, advanced in PANES equal steps.
+ * Each pane keeps its own aggregate, a query merges the panes that
+ * are still inside the window. Memory is PANES * sizeof(BME680_WindowStats).
+ * Panes are counted from the first sample in serial arithmetic, so the ring stays
+ * in step when the millisecond timestamp wraps around at 2^32.
+ */
+template<uint16_t PANES>
+class BME680_SlidingAggregator : public BME680_SampleSink
+{
+public:
+	BME680_SlidingAggregator(uint32_t windowLength, const BME680_StatsConfig &config = BME680_StatsConfig())
+		: paneLength(windowLength / PANES ? windowLength / PANES : 1), started(false), head(0), newest(0)
+	{
+		for (uint16_t i = 0; i < PANES; i++)
+		{
+			panes[i].setup(config);
+			panes[i].length = paneLength;
+			used[i] = false;
+		}
+		result.setup(config);
+	}
+
+	void add(const BME680_Sample &sample)
+	{
+		if (!started)
+		{
+			newest = sample.timestamp - sample.timestamp % paneLength;
+			panes[head].reset(newest);
+			used[head] = true;
+			started = true;
+		}
+		uint32_t ahead = sample.timestamp - newest;
+		if (ahead < 0x80000000u)
+		{
+			/* Open the panes up to the sample's, the skipped ones are empty */
+			uint32_t steps = ahead / paneLength;
+			for (uint32_t i = 0; i < steps && i < PANES; i++)
+			{
+				head = (uint16_t)((head + 1) % PANES);
+				used[head] = false;
+			}
+			if (steps)
+			{
+				newest += steps * paneLength;
+				panes[head].reset(newest);
+				used[head] = true;
+			}
+			panes[head].add(sample);
+			return;
+		}
+		/* Late sample: into its pane if that is still kept */
+		uint32_t back = (newest - sample.timestamp + paneLength - 1) / paneLength;
+		uint16_t i = (uint16_t)((head + PANES - back % PANES) % PANES);
+		if (back < PANES && used[i])
+			panes[i].add(sample);
+	}
+
+	/* Statistics of the window ending at 'now' (ms), the oldest pane may be partially covered */
+	const BME680_WindowStats &query(uint32_t now)
+	{
+		uint32_t window = paneLength * PANES;
+		result.reset(now - window);
+		result.length = window;
+		for (uint16_t i = 0; i < PANES; i++)
+			if (used[i] && (uint32_t)(now - panes[i].start) < window)
+				result.merge(panes[i]);
+		return result;
+	}
+
+private:
+	uint32_t paneLength;
+	bool started;
+	uint16_t head; // pane of the newest sample
+	uint32_t newest; // start of that pane in ms
+	BME680_WindowStats panes[PANES];
+	bool used[PANES];
+	BME680_WindowStats result;
+};
+
+#endif
@@ -0,0 +1,244 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_StatusRegisters.hpp
+ */
+
+#ifndef BME680_STATUSREGISTERS_HPP
+#define BME680_STATUSREGISTERS_HPP
+
+#include <cinttypes>
+
+/*
+ * Status registers of BME680_Base: device identification, reset, SPI page and measurement status.
+ * Include this header alone where only the constants are needed:
+ * BME680_StatusRegisters::STATUS::__address is BME680_Base::STATUS::__address.
+ */
+struct BME680_StatusRegisters
+{
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                            REG STATUS                                             *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG STATUS:
+	 * 5.3.1.4
+	 * In SPI mode complete memory page is accessed using page 0 & page 1.
+	 * Register spi_mem_page is used for page selection. After power-on, spi_mem_page
+	 * is in its reset state and page 0(0x00 to 0x7F) will be active. Page1 (0x7F to 0xFF)
+	 * will be active on setting spi_mem_page. Please refer Table 15 for better
+	 * understanding.
+	 */
+	struct STATUS
+	{
+		static const uint16_t __address = 115;
+		
+		/* Bits unused_0: */
+		struct unused_0
+		{
+			static const uint8_t dflt = 0b000; // 3'b0
+			static const uint8_t mask = 0b11100000; // [5,6,7]
+		};
+		/* Bits spi_mem_page: */
+		/* Selects memory map page in SPI mode */
+		struct spi_mem_page
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b00010000; // [4]
+		};
+		/* Bits unused_1: */
+		struct unused_1
+		{
+			static const uint8_t dflt = 0b0001; // 4'b1
+			static const uint8_t mask = 0b00001111; // [0,1,2,3]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                            REG RESET                                             *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG RESET:
+	 * 5.3.1.5
+	 * Writing 0xB6 to this register initiates a soft-reset procedure, which has the
+	 * same effect like power-on reset. The default value stored in this register is 0x00.
+	 */
+	struct RESET
+	{
+		static const uint16_t __address = 224;
+		
+		/* Bits Reset: */
+		struct Reset
+		{
+			static const uint8_t dflt = 0b00000000; // 8'b0
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+			static const uint8_t RESET = 0xb6; // 
+		};
+	};
+	
+	
+	/*****************************************************************************************************\
+	 *                                                                                                   *
+	 *                                              REG Id                                               *
+	 *                                                                                                   *
+	\*****************************************************************************************************/
+	
+	/*
+	 * REG Id:
+	 * 5.3.1.6
+	 * Chip id of the device
+	 */
+	struct Id
+	{
+		static const uint16_t __address = 208;
+		
+		/* Bits chip_id: */
+		struct chip_id
+		{
+			static const uint8_t dflt = 0b01100001; // 8'b1100001
+			static const uint8_t mask = 0b11111111; // [0,1,2,3,4,5,6,7]
+		};
+	};
+	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                        REG meas_status_0                                         *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * REG meas_status_0:
+	 * 5.3.5.1 New data status
+	 * 5.3.5.2 Gas measuring status
+	 * 5.3.5.3 Measuring status
+	 * 5.3.5.4 Gas Measurement Index
+	 */
+	struct meas_status_0
+	{
+		static const uint16_t __address = 29;
+		
+		/* Bits new_data_0: */
+		/*
+		 * New data flag
+		 * The measured data are stored into the output data registers at the end
+		 * of each TPHG conversion phase along with status flags and index of measurement.
+		 */
+		struct new_data_0
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b10000000; // [7]
+		};
+		/* Bits gas_measuring: */
+		/*
+		 * Gas measuring status flag
+		 * Measuring bit is set to “1‟ only during gas measurements, goes to “0‟ as soon as
+		 * measurement is completed and data transferred to data registers. The registers storing
+		 * the configuration values for the measurement (gas_wait_shared, gas_wait_x, res_heat_x,
+		 * idac_heat_x, image registers) should not be changed when the device is measuring.
+		 */
+		struct gas_measuring
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b01000000; // [6]
+		};
+		/* Bits measuring: */
+		/*
+		 * Measuring status flag
+		 * Measuring status will be set to ‘1’ whenever a conversion (temperature, pressure,
+		 * humidity and gas) is running and back to ‘0’ when the results have been transferred
+		 * to the data registers.
+		 */
+		struct measuring
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b00100000; // [5]
+		};
+		/* Bits unused_0: */
+		struct unused_0
+		{
+			static const uint8_t dflt = 0b0; // 1'b0
+			static const uint8_t mask = 0b00010000; // [4]
+		};
+		/* Bits gas_meas_index_0: */
+		/*
+		 * Gas measurement index
+		 * User can program a sequence of up to 10 conversions by setting nb_conv<3:0>.
+		 * Each conversion has its own heater resistance target but 3 field registers to store
+		 * conversion results. The actual gas conversion number in the measurement sequence
+		 * (up to 10 conversions numbered from 0 to 9) is stored in gas_meas_index register.
+		 */
+		struct gas_meas_index_0
+		{
+			static const uint8_t dflt = 0b0000; // 4'b0
+			static const uint8_t mask = 0b00001111; // [0,1,2,3]
+		};
+	};
+	
+};
+
+/* Set/get accessors of the status registers, D implements read8 and write */
+template <class D>
+class BME680_StatusAccess : public BME680_StatusRegisters
+{
+public:
+	/* Set register STATUS */
+	void setSTATUS(uint8_t value)
+	{
+		static_cast<D *>(this)->write(STATUS::__address, value, 8);
+	}
+	
+	/* Get register STATUS */
+	uint8_t getSTATUS()
+	{
+		return static_cast<D *>(this)->read8(STATUS::__address, 8);
+	}
+	
+	/* Set register RESET */
+	void setRESET(uint8_t value)
+	{
+		static_cast<D *>(this)->write(RESET::__address, value, 8);
+	}
+	
+	/* Get register RESET */
+	uint8_t getRESET()
+	{
+		return static_cast<D *>(this)->read8(RESET::__address, 8);
+	}
+	
+	/* Set register Id */
+	void setId(uint8_t value)
+	{
+		static_cast<D *>(this)->write(Id::__address, value, 8);
+	}
+	
+	/* Get register Id */
+	uint8_t getId()
+	{
+		return static_cast<D *>(this)->read8(Id::__address, 8);
+	}
+	
+	/* Set register meas_status_0 */
+	void setmeas_status_0(uint8_t value)
+	{
+		static_cast<D *>(this)->write(meas_status_0::__address, value, 8);
+	}
+	
+	/* Get register meas_status_0 */
+	uint8_t getmeas_status_0()
+	{
+		return static_cast<D *>(this)->read8(meas_status_0::__address, 8);
+	}
+};
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Timing.cpp
+ */
+
+#include "BME680.hpp"
+#include "BME680_Timing.hpp"
+
+uint8_t BME680_Timing::factor(uint8_t osrs)
+{
+	static const uint8_t f[6] = { 0, 1, 2, 4, 8, 16 };
+	return f[osrs < 6 ? osrs : 5];
+}
+
+uint8_t BME680_Timing::code(uint8_t factor)
+{
+	uint8_t osrs = BME680_Base::Ctrl_meas::osrs_t::SKIPPED;
+	while (osrs < BME680_Base::Ctrl_meas::osrs_t::X16 && BME680_Timing::factor(osrs) < factor)
+		osrs++;
+	return osrs;
+}
+
+uint32_t BME680_Timing::tphg(uint8_t osrs_t, uint8_t osrs_p, uint8_t osrs_h, bool gas)
+{
+	uint32_t cycles = factor(osrs_t) + factor(osrs_p) + factor(osrs_h);
+	return cycles * CYCLE_US + SWITCH_US + (gas ? GAS_US : 0) + WAKEUP_US;
+}
+
+uint32_t BME680_Timing::gasWait(uint8_t gas_wait)
+{
+	typedef BME680_Base::Gas_wait_0 R;
+	static const uint8_t mult[4] = { 1, 4, 16, 64 };
+	return (gas_wait & R::gas_wait_val::mask) * mult[(gas_wait & R::gas_wait_mult::mask) >> 6];
+}
+
+uint8_t BME680_Timing::gasWaitCode(uint32_t ms)
+{
+	typedef BME680_Base::Gas_wait_0 R;
+	if (ms >= 0x3f * 64)
+		return 0xff;
+	uint8_t mult = R::gas_wait_mult::X1;
+	/* Round up so the wait is never shorter than requested */
+	while (ms > R::gas_wait_val::mask)
+	{
+		ms = (ms + 3) / 4;
+		mult++;
+	}
+	return (uint8_t)((mult << 6) | ms);
+}
+
+uint8_t BME680_Timing::gasWaitCodeAtMost(uint32_t ms)
+{
+	typedef BME680_Base::Gas_wait_0 R;
+	/* Rounding down in each multiplier, the coarser one can still come closer (252 ms: 63 x 4, not 15 x 16) */
+	uint8_t best = 0;
+	for (uint8_t mult = R::gas_wait_mult::X1; mult <= R::gas_wait_mult::X64; mult++)
+	{
+		uint32_t value = ms >> (2 * mult);
+		uint8_t code = (uint8_t)((mult << 6) | (value < R::gas_wait_val::mask ? value : R::gas_wait_val::mask));
+		if (gasWait(code) > gasWait(best))
+			best = code;
+	}
+	return best;
+}
@@ -0,0 +1,43 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Timing.hpp
+ */
+
+#ifndef BME680_TIMING_HPP
+#define BME680_TIMING_HPP
+
+#include <cinttypes>
+
+/*
+ * Conversion timing of a TPHG cycle, following the Bosch reference driver:
+ * 1963 us per oversampling cycle, 4 x 477 us TPH switching, 5 x 477 us for the
+ * gas conversion and 1 ms wake up. The heater wait time comes on top of it.
+ */
+struct BME680_Timing
+{
+	static const uint32_t CYCLE_US = 1963;
+	static const uint32_t SWITCH_US = 477 * 4;
+	static const uint32_t GAS_US = 477 * 5;
+	static const uint32_t WAKEUP_US = 1000;
+
+	/* Oversampling factor of an osrs_x code: SKIPPED = 0, X1 = 1 .. X16 = 16 */
+	static uint8_t factor(uint8_t osrs);
+	/* osrs_x code of the smallest oversampling >= factor (0 gives SKIPPED) */
+	static uint8_t code(uint8_t factor);
+
+	/* Duration of the TPH conversions (and the gas conversion if gas is set) in us */
+	static uint32_t tphg(uint8_t osrs_t, uint8_t osrs_p, uint8_t osrs_h, bool gas);
+
+	/* Heater wait time in ms of a Gas_wait_x register value */
+	static uint32_t gasWait(uint8_t gas_wait);
+	/* Gas_wait_x register value for a wait of at least ms milliseconds (max 4032) */
+	static uint8_t gasWaitCode(uint32_t ms);
+	/* Gas_wait_x register value for the longest wait of at most ms milliseconds */
+	static uint8_t gasWaitCodeAtMost(uint32_t ms);
+};
+
+#endif
@@ -0,0 +1,245 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Transport.cpp
+ */
+
+#include <cstring>
+#include "BME680_Transport.hpp"
+
+const char *BME680_Status::name(uint8_t status)
+{
+	switch (status)
+	{
+	case OK: return "OK";
+	case NACK: return "NACK";
+	case TIMEOUT: return "TIMEOUT";
+	case BUS_ERROR: return "BUS_ERROR";
+	case CIRCUIT_OPEN: return "CIRCUIT_OPEN";
+	}
+	return "UNKNOWN";
+}
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                              DEVICE                                               *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+BME680_TransportDevice::BME680_TransportDevice(BME680_Transport &t)
+	: transport(t), firstError(BME680_Status::OK)
+{
+}
+
+void BME680_TransportDevice::check(uint8_t status, uint16_t address)
+{
+	if (status == BME680_Status::OK)
+		return;
+	if (firstError == BME680_Status::OK)
+		firstError = status;
+#ifdef BME680_USE_EXCEPTIONS
+	throw BME680_TransportError(status, address);
+#else
+	(void)address;
+#endif
+}
+
+uint8_t BME680_TransportDevice::read8(uint16_t address, uint16_t)
+{
+	uint8_t value = 0;
+	uint8_t status = transport.read(address, &value, 1);
+	check(status, address);
+	return status == BME680_Status::OK ? value : 0;
+}
+
+void BME680_TransportDevice::write(uint16_t address, uint8_t value, uint16_t)
+{
+	check(transport.write(address, &value, 1), address);
+}
+
+void BME680_TransportDevice::readBurst(uint16_t address, uint8_t *data, uint16_t count)
+{
+	uint8_t status = transport.read(address, data, count);
+	if (status != BME680_Status::OK)
+		memset(data, 0, count);
+	check(status, address);
+}
+
+void BME680_TransportDevice::writeBurst(uint16_t address, const uint8_t *data, uint16_t count)
+{
+	check(transport.write(address, data, count), address);
+}
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                             RESILIENT                                             *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+BME680_ResilientTransport::BME680_ResilientTransport(BME680_Transport &t, BME680_Clock &c, BME680_BusStats *s)
+	: transport(t), clock(c), stats(s), retries(2), backoff(500), maxBackoff(4000),
+	threshold(3), openTime(1000000), maxOpenTime(60000000),
+	failures(0), currentOpenTime(1000000), openUntil(0), open(false)
+{
+}
+
+void BME680_ResilientTransport::setRetry(uint8_t count, uint32_t backoffUs, uint32_t maxBackoffUs)
+{
+	retries = count;
+	backoff = backoffUs;
+	maxBackoff = maxBackoffUs;
+}
+
+void BME680_ResilientTransport::setBreaker(uint8_t failureThreshold, uint32_t openUs, uint32_t maxOpenUs)
+{
+	threshold = failureThreshold;
+	openTime = currentOpenTime = openUs;
+	maxOpenTime = maxOpenUs;
+}
+
+uint8_t BME680_ResilientTransport::state()
+{
+	if (!open)
+		return CLOSED;
+	return clock.micros() >= openUntil ? HALF_OPEN : OPEN;
+}
+
+void BME680_ResilientTransport::reset()
+{
+	open = false;
+	failures = 0;
+	currentOpenTime = openTime;
+}
+
+uint8_t BME680_ResilientTransport::read(uint16_t address, uint8_t *data, uint16_t count)
+{
+	return transfer(true, address, data, count);
+}
+
+uint8_t BME680_ResilientTransport::write(uint16_t address, const uint8_t *data, uint16_t count)
+{
+	return transfer(false, address, const_cast<uint8_t *>(data), count);
+}
+
+uint8_t BME680_ResilientTransport::transfer(bool isRead, uint16_t address, uint8_t *data, uint16_t count)
+{
+	uint8_t s = state();
+	if (s == OPEN)
+		return BME680_Status::CIRCUIT_OPEN;
+
+	/* A half open circuit gets a single trial without retries */
+	uint8_t attempts = s == HALF_OPEN ? 1 : (uint8_t)(retries + 1);
+	uint32_t wait = backoff;
+	uint8_t status = BME680_Status::OK;
+	for (uint8_t i = 0; i < attempts; i++)
+	{
+		if (i)
+		{
+			if (stats)
+				stats->retries++;
+			clock.sleep(wait);
+			wait = wait * 2 < maxBackoff ? wait * 2 : maxBackoff;
+		}
+		status = isRead ? transport.read(address, data, count) : transport.write(address, data, count);
+		if (stats)
+			stats->transactions++;
+		if (status == BME680_Status::OK)
+		{
+			if (stats)
+				stats->bytes += count;
+			failures = 0;
+			if (open)
+				reset();
+			return status;
+		}
+		if (stats)
+			stats->errors++;
+	}
+
+	if (failures < 255)
+		failures++;
+	if (s == HALF_OPEN)
+	{
+		currentOpenTime = currentOpenTime * 2 < maxOpenTime ? currentOpenTime * 2 : maxOpenTime;
+		openUntil = clock.micros() + currentOpenTime;
+	}
+	else if (failures >= threshold)
+	{
+		open = true;
+		openUntil = clock.micros() + currentOpenTime;
+	}
+	return status;
+}
+
+/*****************************************************************************************************\
+ *                                                                                                   *
+ *                                              FAULTY                                               *
+ *                                                                                                   *
+\*****************************************************************************************************/
+
+BME680_FaultyTransport::BME680_FaultyTransport(BME680_Base &device)
+	: attempts(0), failures(0), dev(device), failCount(0), failStatus(BME680_Status::OK), rate(0),
+	random(1), rateStatus(BME680_Status::OK), dead(BME680_Status::OK)
+{
+}
+
+void BME680_FaultyTransport::failNext(uint16_t count, uint8_t status)
+{
+	failCount = count;
+	failStatus = status;
+}
+
+void BME680_FaultyTransport::setFailureRate(uint16_t r, uint32_t seed, uint8_t status)
+{
+	rate = r;
+	random = seed;
+	rateStatus = status;
+}
+
+void BME680_FaultyTransport::setDead(uint8_t status)
+{
+	dead = status;
+}
+
+uint8_t BME680_FaultyTransport::fault()
+{
+	attempts++;
+	uint8_t status = BME680_Status::OK;
+	if (dead != BME680_Status::OK)
+		status = dead;
+	else if (failCount)
+	{
+		failCount--;
+		status = failStatus;
+	}
+	else if (rate)
+	{
+		random = random * 1103515245 + 12345;
+		if (((random >> 16) & 0xFFFF) < rate)
+			status = rateStatus;
+	}
+	if (status != BME680_Status::OK)
+		failures++;
+	return status;
+}
+
+uint8_t BME680_FaultyTransport::read(uint16_t address, uint8_t *data, uint16_t count)
+{
+	uint8_t status = fault();
+	if (status == BME680_Status::OK)
+		dev.readBurst(address, data, count);
+	else
+		memset(data, 0xFF, count); // idle bus level
+	return status;
+}
+
+uint8_t BME680_FaultyTransport::write(uint16_t address, const uint8_t *data, uint16_t count)
+{
+	uint8_t status = fault();
+	if (status == BME680_Status::OK)
+		dev.writeBurst(address, data, count);
+	return status;
+}
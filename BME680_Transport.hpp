@@ -0,0 +1,163 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        BME680_Transport.hpp
+ */
+
+#ifndef BME680_TRANSPORT_HPP
+#define BME680_TRANSPORT_HPP
+
+#include <cinttypes>
+#include "BME680.hpp"
+#include "BME680_BusStats.hpp"
+#include "BME680_Clock.hpp"
+
+/* Result of a bus transaction */
+struct BME680_Status
+{
+	static const uint8_t OK = 0;
+	static const uint8_t NACK = 1; // device did not acknowledge
+	static const uint8_t TIMEOUT = 2;
+	static const uint8_t BUS_ERROR = 3; // arbitration lost, I/O error of the driver, ...
+	static const uint8_t CIRCUIT_OPEN = 4; // not attempted, the device is considered dead
+
+	static const char *name(uint8_t status);
+};
+
+/* Derive from class BME680_Transport to access the bus with error reporting */
+class BME680_Transport
+{
+public:
+	virtual ~BME680_Transport() {}
+
+	/* Pure virtual functions that need to be implemented in derived class: */
+	virtual uint8_t read(uint16_t address, uint8_t *data, uint16_t count) = 0;  // burst read, returns BME680_Status
+	virtual uint8_t write(uint16_t address, const uint8_t *data, uint16_t count) = 0;  // burst write, returns BME680_Status
+};
+
+#ifdef BME680_USE_EXCEPTIONS
+/* Thrown by BME680_TransportDevice when built with BME680_USE_EXCEPTIONS */
+struct BME680_TransportError
+{
+	uint8_t status;
+	uint16_t address;
+
+	BME680_TransportError(uint8_t s, uint16_t a) : status(s), address(a) {}
+};
+#endif
+
+/*
+ * BME680_Base on top of a transport, for the register accessors and drivers.
+ * BME680_Base has no error reporting: a failed read returns 0 and the first failure
+ * is kept in status() until clearStatus(), so a caller can check a whole sequence of
+ * accesses at once. With BME680_USE_EXCEPTIONS defined, failures throw BME680_TransportError.
+ */
+class BME680_TransportDevice : public BME680_Base
+{
+public:
+	BME680_TransportDevice(BME680_Transport &transport);
+
+	uint8_t read8(uint16_t address, uint16_t n=8);
+	void write(uint16_t address, uint8_t value, uint16_t n=8);
+	void readBurst(uint16_t address, uint8_t *data, uint16_t count);
+	void writeBurst(uint16_t address, const uint8_t *data, uint16_t count);
+
+	uint8_t status() const { return firstError; }
+	void clearStatus() { firstError = BME680_Status::OK; }
+
+private:
+	void check(uint8_t status, uint16_t address);
+
+	BME680_Transport &transport;
+	uint8_t firstError;
+};
+
+/*
+ * Bounded retries with exponential backoff and a circuit breaker for one device.
+ * A failed transaction is repeated up to 'retries' times, waiting backoff, 2 x backoff, ...
+ * (at most maxBackoff) in between. After 'threshold' consecutive failed transactions
+ * the circuit opens: every access fails at once with CIRCUIT_OPEN for openTime, without
+ * touching the bus, so a dead device does not take bus time from the others.
+ * Then one trial access is let through (half open), which closes the circuit on success
+ * and opens it again, for twice as long up to maxOpenTime, on failure.
+ */
+class BME680_ResilientTransport : public BME680_Transport
+{
+public:
+	/* Circuit breaker states */
+	static const uint8_t CLOSED = 0;
+	static const uint8_t OPEN = 1;
+	static const uint8_t HALF_OPEN = 2;
+
+	BME680_ResilientTransport(BME680_Transport &transport, BME680_Clock &clock, BME680_BusStats *stats = 0);
+
+	/* Default: 2 retries, 500 us doubling up to 4 ms */
+	void setRetry(uint8_t retries, uint32_t backoffUs, uint32_t maxBackoffUs);
+	/* Default: open after 3 failed transactions for 1 s, up to 60 s */
+	void setBreaker(uint8_t threshold, uint32_t openUs, uint32_t maxOpenUs);
+
+	uint8_t read(uint16_t address, uint8_t *data, uint16_t count);
+	uint8_t write(uint16_t address, const uint8_t *data, uint16_t count);
+
+	uint8_t state();
+	/* Close the circuit, e.g. after the device was replaced */
+	void reset();
+
+private:
+	uint8_t transfer(bool read, uint16_t address, uint8_t *data, uint16_t count);
+
+	BME680_Transport &transport;
+	BME680_Clock &clock;
+	BME680_BusStats *stats;
+
+	uint8_t retries;
+	uint32_t backoff;
+	uint32_t maxBackoff;
+	uint8_t threshold;
+	uint32_t openTime;
+	uint32_t maxOpenTime;
+
+	uint8_t failures; // consecutive failed transactions
+	uint32_t currentOpenTime;
+	uint64_t openUntil;
+	bool open;
+};
+
+/*
+ * Transport over a BME680_Base (e.g. BME680_Simulator) with injected faults, for tests.
+ * Faults are deterministic: explicit failures first, then a pseudo-random failure rate.
+ */
+class BME680_FaultyTransport : public BME680_Transport
+{
+public:
+	BME680_FaultyTransport(BME680_Base &dev);
+
+	/* The next 'count' transactions fail with status */
+	void failNext(uint16_t count, uint8_t status = BME680_Status::NACK);
+	/* Fail with probability rate / 65536, pseudo-random sequence from seed */
+	void setFailureRate(uint16_t rate, uint32_t seed = 1, uint8_t status = BME680_Status::TIMEOUT);
+	/* Every transaction fails with status until set back to OK */
+	void setDead(uint8_t status = BME680_Status::NACK);
+
+	uint8_t read(uint16_t address, uint8_t *data, uint16_t count);
+	uint8_t write(uint16_t address, const uint8_t *data, uint16_t count);
+
+	uint32_t attempts; // transactions that reached this transport
+	uint32_t failures; // of which failed
+
+private:
+	uint8_t fault();
+
+	BME680_Base &dev;
+	uint16_t failCount;
+	uint8_t failStatus;
+	uint16_t rate;
+	uint32_t random;
+	uint8_t rateStatus;
+	uint8_t dead;
+};
+
+#endif
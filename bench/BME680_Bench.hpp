@@ -0,0 +1,52 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        bench/BME680_Bench.hpp
+ */
+
+#ifndef BME680_BENCH_HPP
+#define BME680_BENCH_HPP
+
+#include <cstdio>
+#include <cinttypes>
+#include "BME680_Clock.hpp"
+
+/*
+ * Minimal benchmark support: a deterministic random sequence for the inputs, a sink
+ * that keeps results alive, and a line per measured rate.
+ *
+ *   BME680_Random random(1);
+ *   uint64_t start = clock.micros();
+ *   for (...) BME680_sink += f(random.next() & 0x3ff);
+ *   BME680_rate("gas resistance", n, clock.micros() - start);
+ */
+
+/* Linear congruential generator, the same sequence on every host */
+struct BME680_Random
+{
+	uint32_t state;
+
+	BME680_Random(uint32_t seed) : state(seed) {}
+
+	uint32_t next()
+	{
+		state = state * 1664525u + 1013904223u;
+		return state >> 8;
+	}
+	/* Uniform in [0, 1) */
+	double uniform() { return next() / 16777216.0; }
+};
+
+static volatile uint32_t BME680_sink = 0;
+
+/* Print a rate in operations per second and the time per operation */
+static inline void BME680_rate(const char *name, uint64_t count, uint64_t elapsedUs)
+{
+	double rate = elapsedUs ? count * 1e6 / elapsedUs : 0.0;
+	printf("  %-40s %10.2f M/s %8.2f ns\n", name, rate / 1e6, rate ? 1e9 / rate : 0.0);
+}
+
+#endif
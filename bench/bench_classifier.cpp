@@ -0,0 +1,163 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        bench/bench_classifier.cpp
+ */
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "BME680_Bench.hpp"
+#include "BME680_GasClassifier.hpp"
+
+static const uint8_t INPUTS = 20; // BME680_GasFeatureBank<..., 10>::FEATURES
+static const uint32_t STRIDE = 32; // its STRIDE
+static const uint32_t ROWS = 4096;
+
+/* Quantized model: the fields of the blob, written by blob() in the layout of gen/gas_model.py */
+struct Model
+{
+	struct Layer
+	{
+		uint8_t outputs;
+		uint8_t activation;
+		std::vector<float> multiplier;
+		std::vector<int32_t> bias;
+		std::vector<int8_t> weights;
+	};
+
+	std::vector<float> mean, scale;
+	std::vector<Layer> layers;
+
+	/* Random weights and biases, hidden layers RELU, multipliers that keep the activations in range */
+	Model(const uint8_t *widths, uint8_t count, BME680_Random &random)
+	{
+		for (uint8_t i = 0; i < INPUTS; i++)
+		{
+			mean.push_back((float)(random.uniform() - 0.5));
+			scale.push_back((float)(20.0 + 20.0 * random.uniform()));
+		}
+		uint8_t in = INPUTS;
+		for (uint8_t l = 0; l < count; l++)
+		{
+			Layer L;
+			L.outputs = widths[l];
+			L.activation = l + 1 < count ? BME680_Activation::RELU : BME680_Activation::LINEAR;
+			for (uint8_t o = 0; o < L.outputs; o++)
+			{
+				L.multiplier.push_back((float)(1.0 / (64.0 * in)));
+				L.bias.push_back((int32_t)(random.next() % 4001) - 2000);
+				for (uint8_t i = 0; i < in; i++)
+					L.weights.push_back((int8_t)((int32_t)(random.next() % 255) - 127));
+			}
+			layers.push_back(L);
+			in = L.outputs;
+		}
+	}
+
+	std::vector<uint8_t> blob() const
+	{
+		std::vector<uint8_t> b;
+		const char magic[8] = { 'B', 'M', 'E', '6', '8', '0', 'M', '1' };
+		for (uint8_t i = 0; i < sizeof(magic); i++)
+			u8(b, (uint8_t)magic[i]);
+		u8(b, INPUTS); u8(b, (uint8_t)layers.size()); u8(b, 0); u8(b, 0);
+		for (uint8_t i = 0; i < INPUTS; i++)
+			f32(b, mean[i]);
+		for (uint8_t i = 0; i < INPUTS; i++)
+			f32(b, scale[i]);
+		for (size_t l = 0; l < layers.size(); l++)
+		{
+			const Layer &L = layers[l];
+			u8(b, L.outputs); u8(b, L.activation); u8(b, 0); u8(b, 0);
+			for (uint8_t o = 0; o < L.outputs; o++)
+				f32(b, L.multiplier[o]);
+			for (uint8_t o = 0; o < L.outputs; o++)
+				i32(b, L.bias[o]);
+			for (size_t w = 0; w < L.weights.size(); w++)
+				u8(b, (uint8_t)L.weights[w]);
+			while (b.size() % 4)
+				u8(b, 0);
+		}
+		return b;
+	}
+
+	/* Class of a row in double precision, as classify() in gen/gas_model.py */
+	uint8_t classify(const float *row) const
+	{
+		std::vector<double> q;
+		for (uint8_t i = 0; i < INPUTS; i++)
+			q.push_back(saturate(((double)row[i] - mean[i]) * scale[i]));
+		for (size_t l = 0; l < layers.size(); l++)
+		{
+			const Layer &L = layers[l];
+			std::vector<double> out;
+			for (uint8_t o = 0; o < L.outputs; o++)
+			{
+				double acc = L.bias[o];
+				for (size_t i = 0; i < q.size(); i++)
+					acc += L.weights[o * q.size() + i] * q[i];
+				if (L.activation == BME680_Activation::RELU && acc < 0)
+					acc = 0;
+				out.push_back(acc * L.multiplier[o]);
+			}
+			if (l + 1 < layers.size())
+				for (size_t o = 0; o < out.size(); o++)
+					out[o] = saturate(out[o]);
+			q = out;
+		}
+		uint8_t best = 0;
+		for (uint8_t o = 1; o < q.size(); o++)
+			if (q[o] > q[best])
+				best = o;
+		return best;
+	}
+
+	static double saturate(double x) { return fmax(-127.0, fmin(127.0, x < 0 ? ceil(x - 0.5) : floor(x + 0.5))); }
+	static void u8(std::vector<uint8_t> &b, uint8_t v) { b.push_back(v); }
+	static void i32(std::vector<uint8_t> &b, int32_t v) { for (int i = 0; i < 4; i++) u8(b, (uint8_t)((uint32_t)v >> (8 * i))); }
+	static void f32(std::vector<uint8_t> &b, float v) { int32_t bits; memcpy(&bits, &v, 4); i32(b, bits); }
+};
+
+/* Check a model against the double precision reference, then measure its rate */
+static bool run(const char *name, const Model &model, const std::vector<float> &rows, BME680_SystemClock &clock)
+{
+	std::vector<uint8_t> blob = model.blob();
+	BME680_GasClassifier classifier;
+	if (!classifier.load(&blob[0], (uint32_t)blob.size()))
+	{
+		printf("  %s: blob rejected\n", name);
+		return false;
+	}
+	uint32_t same = 0, used = 0;
+	for (uint32_t r = 0; r < ROWS; r++)
+	{
+		uint8_t c = classifier.classify(&rows[r * STRIDE]);
+		same += c == model.classify(&rows[r * STRIDE]);
+		used |= 1u << c;
+	}
+	printf("  %s: %u bytes, same class as the reference for %u of %u rows, classes seen %x\n",
+		name, (unsigned)blob.size(), same, ROWS, used);
+	double rate = BME680_classifierRate(classifier, &rows[0], STRIDE, ROWS, clock);
+	BME680_rate(name, (uint64_t)rate, 1000000);
+	return same >= ROWS * 999 / 1000;
+}
+
+int main()
+{
+	BME680_Random random(50);
+	std::vector<float> rows(ROWS * STRIDE, 0.0f);
+	for (uint32_t r = 0; r < ROWS; r++)
+		for (uint8_t i = 0; i < INPUTS; i++)
+			rows[r * STRIDE + i] = (float)(4.0 * (random.uniform() - 0.5));
+
+	static const uint8_t mlp[2] = { 32, 4 };
+	static const uint8_t linear[1] = { 4 };
+	BME680_SystemClock clock;
+	bool ok = run("MLP 20-32-4, rows", Model(mlp, 2, random), rows, clock);
+	ok = run("linear 20-4, rows", Model(linear, 1, random), rows, clock) && ok;
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        bench/bench_compensation.cpp
+ */
+
+#include "BME680_Bench.hpp"
+#include "BME680_Compensation.hpp"
+
+/* Gas resistance as in the Bosch reference driver: everything per sample, signed 64 bit division */
+static uint32_t reference(uint16_t adc, uint8_t range, int8_t range_sw_err)
+{
+	range &= 0x0f;
+	int64_t var1 = (int64_t)((1340 + (5 * (int64_t)range_sw_err)) * ((int64_t)BME680_gasLookup1[range])) >> 16;
+	int64_t var2 = (((int64_t)((int64_t)adc << 15) - (int64_t)16777216) + var1);
+	int64_t var3 = (((int64_t)BME680_gasLookup2[range] * var1) >> 9);
+	return (uint32_t)((var3 + (var2 >> 1)) / var2);
+}
+
+/* BME680_GasTable::resistance with the shift and subtract division forced */
+static uint32_t softDivide(const BME680_GasTable &table, uint16_t adc, uint8_t range)
+{
+	range &= 0x0f;
+	uint32_t var2 = ((uint32_t)adc << 15) - 16777216u + table.var1[range];
+	return BME680_divide64(table.var3[range] + (var2 >> 1), var2);
+}
+
+static const uint32_t INPUTS = 4096;
+static const uint32_t PASSES = 5000;
+
+int main()
+{
+	/* Every ADC code, range and range_sw_err */
+	uint32_t mismatches = 0;
+	for (int8_t err = -8; err < 8; err++)
+	{
+		BME680_GasTable table;
+		table.setup(err);
+		for (uint8_t range = 0; range < 16; range++)
+			for (uint16_t adc = 0; adc < 1024; adc++)
+			{
+				uint32_t r = reference(adc, range, err);
+				mismatches += table.resistance(adc, range) != r;
+				mismatches += softDivide(table, adc, range) != r;
+			}
+	}
+	printf("  gas resistance, 262144 inputs: %u mismatches, BME680_SOFT_DIVIDE %d\n", mismatches, BME680_SOFT_DIVIDE);
+
+	uint16_t adc[INPUTS];
+	uint8_t range[INPUTS];
+	BME680_Random random(1);
+	for (uint32_t i = 0; i < INPUTS; i++)
+	{
+		adc[i] = (uint16_t)(random.next() & 0x3ff);
+		range[i] = (uint8_t)(random.next() & 0x0f);
+	}
+	BME680_GasTable table;
+	table.setup(-3);
+	BME680_SystemClock clock;
+	uint32_t sum = 0;
+
+	uint64_t start = clock.micros();
+	for (uint32_t p = 0; p < PASSES; p++)
+		for (uint32_t i = 0; i < INPUTS; i++)
+			sum += reference(adc[i], range[i], -3);
+	BME680_rate("reference formula", (uint64_t)PASSES * INPUTS, clock.micros() - start);
+
+	start = clock.micros();
+	for (uint32_t p = 0; p < PASSES; p++)
+		for (uint32_t i = 0; i < INPUTS; i++)
+			sum += table.resistance(adc[i], range[i]);
+	BME680_rate("BME680_GasTable", (uint64_t)PASSES * INPUTS, clock.micros() - start);
+
+	start = clock.micros();
+	for (uint32_t p = 0; p < PASSES; p++)
+		for (uint32_t i = 0; i < INPUTS; i++)
+			sum += softDivide(table, adc[i], range[i]);
+	BME680_rate("BME680_GasTable, BME680_divide64", (uint64_t)PASSES * INPUTS, clock.micros() - start);
+
+	BME680_sink = sum;
+	return mismatches ? 1 : 0;
+}
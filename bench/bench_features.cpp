@@ -0,0 +1,82 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        bench/bench_features.cpp
+ */
+
+#include <cmath>
+#include <vector>
+#include "BME680_Bench.hpp"
+#include "BME680_GasFeatures.hpp"
+
+static const uint32_t SENSORS = 8;
+static const uint8_t STEPS = 10;
+static const uint8_t DEPTH = 8;
+static const uint32_t PROFILES = 4096; // per sensor
+static const uint32_t PASSES = 8;
+
+typedef BME680_GasFeatureBank<SENSORS, STEPS, DEPTH> Bank;
+
+/* Static: the 64 byte alignment of the feature rows is not guaranteed by new before C++17 */
+static Bank bank;
+
+/* Features of the last DEPTH profiles of one sensor in double precision, from the definition */
+static void reference(const std::vector<double> &r, uint32_t sensor, uint32_t last, double *features)
+{
+	double mean[STEPS] = { 0 };
+	for (uint32_t p = last + 1 - DEPTH; p <= last; p++)
+		for (uint8_t s = 0; s < STEPS; s++)
+			mean[s] += log(r[(p * SENSORS + sensor) * STEPS + s]) / DEPTH;
+	double num = 0.0, den = 0.0, xbar = (STEPS - 1) / 2.0;
+	for (uint8_t s = 0; s < STEPS; s++)
+	{
+		if (s)
+		{
+			features[BME680_GasFeature::RATIO(s)] = mean[s] - mean[s - 1];
+			features[BME680_GasFeature::NORMALIZED(s, STEPS)] = mean[s] - mean[0];
+		}
+		num += (s - xbar) * mean[s];
+		den += (s - xbar) * (s - xbar);
+	}
+	features[BME680_GasFeature::SLOPE(STEPS)] = num / den;
+	features[BME680_GasFeature::LEVEL(STEPS)] = mean[0];
+}
+
+int main()
+{
+	/* Resistances falling with the heater temperature, 5 % noise, sensor to sensor spread */
+	BME680_Random random(49);
+	std::vector<double> r((size_t)PROFILES * SENSORS * STEPS);
+	for (uint32_t p = 0; p < PROFILES; p++)
+		for (uint32_t sensor = 0; sensor < SENSORS; sensor++)
+			for (uint8_t s = 0; s < STEPS; s++)
+				r[(p * SENSORS + sensor) * STEPS + s] = 50000.0 * (1 + sensor) * exp(-0.2 * s) * (0.95 + 0.1 * random.uniform());
+
+	for (uint32_t i = 0; i < PROFILES * SENSORS * STEPS; i++)
+		bank.add(i / STEPS % SENSORS, (uint8_t)(i % STEPS), r[i]);
+	double error = 0.0;
+	for (uint32_t sensor = 0; sensor < SENSORS; sensor++)
+	{
+		double expected[Bank::FEATURES];
+		reference(r, sensor, PROFILES - 1, expected);
+		for (uint32_t f = 0; f < Bank::FEATURES; f++)
+			error = fmax(error, fabs(bank.features(sensor)[f] - expected[f]));
+	}
+	bool aligned = ((uintptr_t)bank.features() & 63) == 0;
+	printf("  %u profiles: %u dropped, largest error %.2g, rows %s aligned\n",
+		bank.profiles, bank.dropped, error, aligned ? "64 byte" : "not");
+
+	BME680_SystemClock clock;
+	uint32_t updates = 0;
+	uint64_t start = clock.micros();
+	for (uint32_t p = 0; p < PASSES; p++)
+		for (uint32_t i = 0; i < PROFILES * SENSORS * STEPS; i++)
+			updates += bank.add(i / STEPS % SENSORS, (uint8_t)(i % STEPS), r[i]);
+	BME680_rate("BME680_GasFeatureBank::add, samples", (uint64_t)PASSES * PROFILES * SENSORS * STEPS, clock.micros() - start);
+
+	BME680_sink = updates;
+	return error < 1e-4 && !bank.dropped && aligned ? 0 : 1;
+}
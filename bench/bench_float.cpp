@@ -0,0 +1,114 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        bench/bench_float.cpp
+ */
+
+#include <cmath>
+#include <vector>
+#include "BME680_Bench.hpp"
+#include "BME680_FloatCompensation.hpp"
+#include "BME680_Simulator.hpp"
+
+static const uint32_t PASSES = 2000;
+
+static BME680_FloatBank<16> small;
+static BME680_FloatBank<256> medium;
+static BME680_FloatBank<4096> large;
+
+/* Relative error bound of the single precision bank, the one tests/test_FloatCompensation.cpp asserts */
+static const double BOUND = 1e-5;
+
+/* Indoor samples of a fleet: every sensor somewhere in 10..35 degree Celsius, 950..1050 hPa, 20..80 % */
+static void fleet(std::vector<BME680_RawSample> &raws, uint32_t sensors, BME680_Random &random)
+{
+	raws.resize(sensors);
+	for (uint32_t i = 0; i < sensors; i++)
+	{
+		BME680_RawSample &raw = raws[i];
+		raw = BME680_RawSample();
+		raw.temperature = 470000 + random.next() % 60000;
+		raw.pressure = 330000 + random.next() % 40000;
+		raw.humidity = (uint16_t)(20000 + random.next() % 15000);
+		raw.gas = (uint16_t)(random.next() & 0x3ff);
+		raw.gasStatus = (uint8_t)(BME680_Base::gas_r_lsb::gas_valid_r::mask | (random.next() & 0x0f));
+		raw.channels = 0x0f;
+	}
+}
+
+/* Fill the bank, check it against the double precision reference, then measure its rate */
+template<uint32_t LANES>
+static bool run(BME680_FloatBank<LANES> &bank, const BME680_Calibration &cal, BME680_Random &random, BME680_SystemClock &clock)
+{
+	std::vector<BME680_RawSample> raws;
+	fleet(raws, LANES, random);
+	for (uint32_t lane = 0; lane < LANES; lane++)
+	{
+		bank.setCalibration(lane, cal);
+		bank.setRaw(lane, raws[lane]);
+	}
+	bank.compensate();
+
+	double worst[BME680_Channel::COUNT] = { 0 };
+	for (uint32_t lane = 0; lane < LANES; lane++)
+	{
+		BME680_Sample reference;
+		BME680_compensateDouble(cal, raws[lane], reference);
+		double value[BME680_Channel::COUNT] = { bank.temperature(lane), bank.pressure(lane), bank.humidity(lane), bank.gas(lane) };
+		for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+			worst[c] = fmax(worst[c], fabs(value[c] - reference.value[c]) / fmax(fabs(reference.value[c]), 1.0));
+	}
+	bool ok = true;
+	for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+		ok = ok && worst[c] < BOUND;
+	printf("  %u sensors: largest relative error T %.1e, P %.1e, H %.1e, G %.1e\n",
+		LANES, worst[0], worst[1], worst[2], worst[3]);
+
+	uint64_t start = clock.micros();
+	for (uint32_t p = 0; p < PASSES; p++)
+		bank.compensate();
+	char name[64];
+	snprintf(name, sizeof(name), "BME680_FloatBank<%u>, samples", LANES);
+	BME680_rate(name, (uint64_t)PASSES * LANES, clock.micros() - start);
+	BME680_sink = (uint32_t)bank.temperature(0);
+	return ok;
+}
+
+int main()
+{
+	BME680_Simulator sim;
+	BME680_Calibration cal;
+	cal.read(sim);
+
+	printf("  path %s, %u lanes per vector\n", BME680_floatPath(), BME680_FLOAT_WIDTH);
+	BME680_FloatAccuracy report;
+	BME680_floatAccuracy(cal, report);
+	static const char *names[BME680_Channel::COUNT] = { "temperature", "pressure", "humidity", "gas" };
+	bool ok = true;
+	for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+	{
+		printf("  %-12s %6u samples, error max %.3g mean %.3g, relative max %.2g\n", names[c],
+			report.samples[c], report.maxError[c], report.meanError[c], report.maxRelative[c]);
+		ok = ok && report.samples[c] && report.maxRelative[c] < BOUND;
+	}
+
+	BME680_Random random(41);
+	BME680_SystemClock clock;
+	ok = run(small, cal, random, clock) && ok;
+	ok = run(medium, cal, random, clock) && ok;
+	ok = run(large, cal, random, clock) && ok;
+
+	/* The double precision reference, one sample at a time */
+	std::vector<BME680_RawSample> raws;
+	fleet(raws, 4096, random);
+	BME680_Sample sample;
+	uint64_t start = clock.micros();
+	for (uint32_t p = 0; p < PASSES / 16; p++)
+		for (uint32_t i = 0; i < raws.size(); i++)
+			BME680_sink += BME680_compensateDouble(cal, raws[i], sample);
+	BME680_rate("BME680_compensateDouble, samples", (uint64_t)PASSES / 16 * raws.size(), clock.micros() - start);
+	return ok ? 0 : 1;
+}
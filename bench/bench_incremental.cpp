@@ -0,0 +1,103 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        bench/bench_incremental.cpp
+ */
+
+#include <vector>
+#include "BME680_Bench.hpp"
+#include "BME680_Calibration.hpp"
+#include "BME680_IncrementalCompensation.hpp"
+#include "BME680_Simulator.hpp"
+
+static const uint32_t SAMPLES = 200000;
+static const uint32_t PASSES = 20;
+
+/* One raw ADC step up or down with the given probability per sample */
+static uint32_t walk(BME680_Random &random, uint32_t value, double probability)
+{
+	double u = random.uniform();
+	if (u < probability / 2)
+		return value - 1;
+	if (u < probability)
+		return value + 1;
+	return value;
+}
+
+/*
+ * Indoor signal sampled every few seconds: the raw temperature moves by one code in 17 %
+ * of the samples, pressure, humidity and gas in 10 %. The gas range stays the same.
+ */
+static void indoor(std::vector<BME680_RawSample> &samples)
+{
+	BME680_Random random(46);
+	BME680_RawSample raw;
+	raw.temperature = 500000;
+	raw.pressure = 350000;
+	raw.humidity = 24000;
+	raw.gas = 600;
+	raw.gasStatus = 0x30 | 5; // gas_valid_r, heat_stab_r, range 5
+	raw.channels = 0x0f;
+	for (uint32_t i = 0; i < SAMPLES; i++)
+	{
+		raw.temperature = walk(random, raw.temperature, 0.17);
+		raw.pressure = walk(random, raw.pressure, 0.10);
+		raw.humidity = (uint16_t)walk(random, raw.humidity, 0.10);
+		raw.gas = (uint16_t)walk(random, raw.gas, 0.10);
+		samples.push_back(raw);
+	}
+}
+
+static bool same(const BME680_Sample &a, const BME680_Sample &b)
+{
+	if (a.valid != b.valid)
+		return false;
+	for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+		if (a.value[c] != b.value[c])
+			return false;
+	return true;
+}
+
+int main()
+{
+	BME680_Simulator sim;
+	BME680_Calibration cal;
+	cal.read(sim);
+	std::vector<BME680_RawSample> samples;
+	indoor(samples);
+
+	BME680_Compensation full(cal);
+	BME680_IncrementalCompensation incremental(cal);
+	uint32_t mismatches = 0;
+	for (uint32_t i = 0; i < SAMPLES; i++)
+	{
+		BME680_Sample a, b;
+		full.compensate(samples[i], a);
+		incremental.compensate(samples[i], b);
+		mismatches += !same(a, b);
+	}
+	uint32_t results = incremental.computed + incremental.reused;
+	printf("  %u samples: %u mismatches, %.1f %% of the results from the cache, terms rebuilt for %.1f %% of the samples\n",
+		SAMPLES, mismatches, 100.0 * incremental.reused / results, 100.0 * incremental.termUpdates / 2 / SAMPLES);
+
+	BME680_SystemClock clock;
+	BME680_Sample sample;
+	uint32_t valid = 0;
+	uint64_t start = clock.micros();
+	for (uint32_t p = 0; p < PASSES; p++)
+		for (uint32_t i = 0; i < SAMPLES; i++)
+			valid += full.compensate(samples[i], sample);
+	BME680_rate("BME680_Compensation", (uint64_t)PASSES * SAMPLES, clock.micros() - start);
+
+	start = clock.micros();
+	for (uint32_t p = 0; p < PASSES; p++)
+		for (uint32_t i = 0; i < SAMPLES; i++)
+			valid += incremental.compensate(samples[i], sample);
+	BME680_rate("BME680_IncrementalCompensation", (uint64_t)PASSES * SAMPLES, clock.micros() - start);
+
+	BME680_sink = valid;
+	return mismatches ? 1 : 0;
+}
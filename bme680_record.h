@@ -0,0 +1,67 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        bme680_record.h
+ */
+
+#ifndef BME680_RECORD_H
+#define BME680_RECORD_H
+
+/*
+ * Fixed size sample record for exchange between processes (C and C++).
+ * The layout is part of the ABI: fields are only ever appended into 'reserved',
+ * with BME680_RECORD_VERSION incremented. All fields are naturally aligned and
+ * little endian on the supported platforms; the struct is packed so that no
+ * compiler adds padding of its own.
+ */
+
+#include <stdint.h>
+
+#define BME680_RECORD_VERSION 1
+#define BME680_RECORD_SIZE 64
+
+/* Bits of bme680_record.valid, same order as BME680_Channel */
+#define BME680_RECORD_TEMPERATURE 0x01
+#define BME680_RECORD_PRESSURE 0x02
+#define BME680_RECORD_HUMIDITY 0x04
+#define BME680_RECORD_GAS 0x08
+
+/* Bits of bme680_record.flags */
+#define BME680_RECORD_NEW_DATA 0x01 /* meas_status_0::new_data_0 */
+#define BME680_RECORD_GAS_VALID 0x02 /* gas_r_lsb::gas_valid_r */
+#define BME680_RECORD_HEAT_STAB 0x04 /* gas_r_lsb::heat_stab_r */
+
+#if defined(_MSC_VER)
+#pragma pack(push, 1)
+#define BME680_PACKED
+#else
+#define BME680_PACKED __attribute__((packed))
+#endif
+
+typedef struct BME680_PACKED bme680_record
+{
+	uint16_t version; /*  0: BME680_RECORD_VERSION */
+	uint16_t size; /*  2: BME680_RECORD_SIZE */
+	uint32_t sensor_id; /*  4 */
+	uint64_t timestamp_us; /*  8: monotonic time of the measurement */
+	int32_t temperature; /* 16: 0.01 degree Celsius */
+	uint32_t pressure; /* 20: Pa */
+	uint32_t humidity; /* 24: 0.001 % relative humidity */
+	uint32_t gas_resistance; /* 28: Ohm */
+	uint8_t raw[15]; /* 32: data registers 29 (meas_status_0) .. 43 (gas_r_lsb) as read, 0 where the mode did not read them */
+	uint8_t valid; /* 47: BME680_RECORD_TEMPERATURE .. BME680_RECORD_GAS */
+	uint8_t flags; /* 48: BME680_RECORD_NEW_DATA, _GAS_VALID, _HEAT_STAB */
+	uint8_t gas_meas_index; /* 49: meas_status_0::gas_meas_index_0 */
+	uint8_t reserved[14]; /* 50: zero */
+} bme680_record;
+
+#if defined(_MSC_VER)
+#pragma pack(pop)
+#endif
+
+typedef char bme680_record_size_check[sizeof(bme680_record) == BME680_RECORD_SIZE ? 1 : -1];
+
+#endif
@@ -0,0 +1,775 @@
+#!/usr/bin/env python3
+#
+# name:        BME680
+# description: Low-power gas, pressure, temperature and humidity sensor
+# manuf:       Bosch Sensortec
+# version:     0.1
+# url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+# file:        gen/bme680_gen.py
+#
+"""Generate the BME680 register layer from a register description.
+
+The register structs (addresses, masks, defaults and enumerated values) are
+split by subsystem into one header per group of the description, e.g.
+BME680_ControlRegisters.hpp with the constants in struct BME680_ControlRegisters
+and the set<REG>/get<REG> accessors in template <class D> BME680_ControlAccess.
+Three variants of the register layer are built on top:
+
+  virtual   BME680.hpp: class BME680_Base, derived from the accessors of all
+            groups, which call the pure virtual read8/write of the derived bus
+            class (the original API). Written together with the group headers
+            and BME680_RegisterTable.cpp, the register map of BME680_Registers.hpp.
+  template  BME680_StaticBase.hpp: template <class D> class BME680_StaticBase,
+            the accessors call D::read8/D::write directly (CRTP), no vtable.
+  table     BME680_TableBase.hpp/.cpp: class BME680_TableBase, one out of line
+            get/set and getField/setField over constant address/field tables.
+
+Usage:
+
+  gen/bme680_gen.py [--api virtual|template|table|all] [--output DIR]
+                    [--check] [--size] [gen/BME680.regs]
+
+--output writes the files into DIR (default: the repository root), --check
+compares with the files in DIR instead and fails on a difference, --size
+compiles a translation unit that calls every accessor once with each variant
+($CXX, default g++, with $CXXFLAGS, default -Os) and reports the code size
+of the objects.
+
+Description format (UTF-8, '#' starts a comment line, indentation by tabs):
+
+  device BME680                      metadata of the file header: device,
+  description ...                    description, manuf, version, url,
+                                     date, author
+  group control                      group of the following registers
+  | Oversampling, IIR filter, ...    group doc, one line
+  reg Ctrl_meas 116 rw               register: name, address, access r|w|rw
+  	| 5.3.1.3 Select sensor power mode       register doc, one line each
+  	field osrs_t 7:5 0               bit field: name, bits msb:lsb (or a
+  		| Temperature oversampling settings  single bit), default value
+  		enum X1 0b01 oversampling x1     named value (literal kept as written),
+                                     comment
+
+Groups, registers and fields are emitted in the order of the description, fields from
+MSB to LSB. Doc lines are kept verbatim, including trailing blanks.
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+
+class Field(object):
+	def __init__(self, name, msb, lsb, dflt):
+		self.name = name
+		self.msb = msb
+		self.lsb = lsb
+		self.dflt = dflt
+		self.doc = []
+		self.enums = []  # (name, literal, comment)
+
+	@property
+	def width(self):
+		return self.msb - self.lsb + 1
+
+	@property
+	def mask(self):
+		return ((1 << self.width) - 1) << self.lsb
+
+
+class Register(object):
+	def __init__(self, name, address, access):
+		self.name = name
+		self.address = address
+		self.access = access
+		self.doc = []
+		self.fields = []
+
+	def struct(self, field):
+		# A member struct cannot have the name of the enclosing struct
+		return field.name + '_' if field.name == self.name else field.name
+
+
+class Group(object):
+	def __init__(self, name):
+		self.name = name
+		self.doc = []
+		self.registers = []
+
+
+class Device(object):
+	def __init__(self):
+		self.meta = {}
+		self.groups = []
+
+	@property
+	def registers(self):
+		return [r for g in self.groups for r in g.registers]
+
+	@property
+	def name(self):
+		return self.meta['device']
+
+
+def fail(path, number, message):
+	sys.exit('%s:%d: %s' % (path, number, message))
+
+
+def parse(path):
+	device = Device()
+	group = register = field = None
+	with open(path, encoding='utf-8') as f:
+		lines = f.read().split('\n')
+	for number, line in enumerate(lines, 1):
+		if not line.strip() or line.startswith('#'):
+			continue
+		depth = len(line) - len(line.lstrip('\t'))
+		text = line[depth:]
+		if text == '|' or text.startswith('| '):
+			doc = text[2:]
+			if depth == 0 and group and not group.registers:
+				group.doc.append(doc)
+			elif depth == 1 and register:
+				register.doc.append(doc)
+			elif depth == 2 and field:
+				field.doc.append(doc)
+			else:
+				fail(path, number, 'doc line without register or field')
+			continue
+		words = text.split(' ')
+		if depth == 0 and words[0] == 'group':
+			if len(words) != 2:
+				fail(path, number, 'expected: group NAME')
+			group = Group(words[1])
+			device.groups.append(group)
+			register = field = None
+		elif depth == 0 and words[0] == 'reg':
+			if len(words) != 4 or words[3] not in ('r', 'w', 'rw'):
+				fail(path, number, 'expected: reg NAME ADDRESS r|w|rw')
+			if not group:
+				fail(path, number, 'register outside of a group')
+			register = Register(words[1], int(words[2], 0), words[3])
+			group.registers.append(register)
+			field = None
+		elif depth == 0:
+			device.meta[words[0]] = ' '.join(words[1:])
+		elif depth == 1 and words[0] == 'field' and register:
+			m = re.match(r'^(\d+)(?::(\d+))?$', words[2]) if len(words) == 4 else None
+			if not m:
+				fail(path, number, 'expected: field NAME MSB[:LSB] DEFAULT')
+			msb = int(m.group(1))
+			lsb = int(m.group(2)) if m.group(2) else msb
+			field = Field(words[1], msb, lsb, int(words[3], 0))
+			if not (0 <= lsb <= msb <= 7) or field.dflt >> field.width:
+				fail(path, number, 'bits or default out of range')
+			if any(f.mask & field.mask for f in register.fields):
+				fail(path, number, 'field overlaps another field')
+			register.fields.append(field)
+		elif depth == 2 and words[0] == 'enum' and field:
+			if len(words) < 3 or int(words[2], 0) >> field.width:
+				fail(path, number, 'expected: enum NAME VALUE [COMMENT], value within the field')
+			field.enums.append((words[1], words[2], ' '.join(words[3:])))
+		else:
+			fail(path, number, 'unexpected line')
+	for key in ('device', 'description', 'manuf', 'version', 'url'):
+		if key not in device.meta:
+			sys.exit('%s: missing %s' % (path, key))
+	return device
+
+
+def file_header(device, name, chisl=False):
+	lines = [
+		'/*',
+		' * name:        %s' % device.name,
+		' * description: %s' % device.meta['description'],
+		' * manuf:       %s' % device.meta['manuf'],
+		' * version:     %s' % device.meta['version'],
+		' * url:         %s' % device.meta['url'],
+	]
+	if chisl:
+		lines.append(' * date:        %s' % device.meta['date'])
+		lines.append(' * author       %s' % device.meta['author'])
+	lines += [' * file:        %s' % name, ' */', '']
+	return lines
+
+
+def doc_block(doc, indent, first=None):
+	"""Doc comment, a single line comment for a single line without heading"""
+	if first is None and len(doc) == 1:
+		return [indent + '/* %s */' % doc[0]]
+	lines = [indent + '/*']
+	if first is not None:
+		lines.append(indent + ' * ' + first)
+	lines += [indent + (' * ' + d if d else ' *') for d in doc]
+	lines.append(indent + ' */')
+	return lines
+
+
+def banner(title, indent):
+	left = (98 - len(title)) // 2
+	width = 2 * left + 1 + len(title)
+	return [
+		indent + '/' + '*' * (width + 2) + '\\',
+		indent + ' *' + ' ' * width + '*',
+		indent + ' *' + ' ' * left + title + ' ' * (left + 1) + '*',
+		indent + ' *' + ' ' * width + '*',
+		indent + '\\' + '*' * (width + 2) + '/',
+	]
+
+
+def register_struct(register, indent):
+	"""Constants of a register, the same in every variant"""
+	i1, i2 = indent + '\t', indent + '\t\t'
+	lines = doc_block(register.doc, indent, 'REG %s:' % register.name)
+	lines += [indent + 'struct %s' % register.name, indent + '{',
+		i1 + 'static const uint16_t __address = %d;' % register.address, i1]
+	for field in register.fields:
+		lines.append(i1 + '/* Bits %s: */' % field.name)
+		if field.doc:
+			lines += doc_block(field.doc, i1)
+		bits = ','.join(str(b) for b in range(field.lsb, field.msb + 1))
+		lines += [i1 + 'struct %s' % register.struct(field), i1 + '{',
+			i2 + "static const uint8_t dflt = 0b%s; // %d'b%s" % (
+				format(field.dflt, '0%db' % field.width), field.width, format(field.dflt, 'b')),
+			i2 + 'static const uint8_t mask = 0b%s; // [%s]' % (format(field.mask, '08b'), bits)]
+		lines += [i2 + 'static const uint8_t %s = %s; // %s' % e for e in field.enums]
+		lines.append(i1 + '};')
+	lines.append(indent + '};')
+	return lines
+
+
+def accessors(register, indent, write, read):
+	i1 = indent + '\t'
+	return [
+		indent + '/* Set register %s */' % register.name,
+		indent + 'void set%s(uint8_t value)' % register.name,
+		indent + '{',
+		i1 + '%s(%s::__address, value, 8);' % (write, register.name),
+		indent + '}',
+		indent,
+		indent + '/* Get register %s */' % register.name,
+		indent + 'uint8_t get%s()' % register.name,
+		indent + '{',
+		i1 + 'return %s(%s::__address, 8);' % (read, register.name),
+		indent + '}',
+	]
+
+
+def register_blocks(registers):
+	lines = []
+	for register in registers:
+		lines += ['\t'] + banner('REG %s' % register.name, '\t') + ['\t']
+		lines += register_struct(register, '\t') + ['\t']
+	return lines
+
+
+def accessor_blocks(registers, write, read):
+	lines = []
+	for register in registers:
+		lines += accessors(register, '\t', write, read) + ['\t']
+	return lines[:-1]
+
+
+VIRTUAL_CLASS = '''\
+/* Derive from class %(D)s_Base and implement the read and write functions! */
+
+/*
+ * %(D)s: %(description)s
+ * The register structs and set/get accessors (%(D)s_Base::Ctrl_meas::osrs_t::X2,
+ * setCtrl_meas(), ...) are inherited from the register headers of the subsystems.
+ */
+class %(D)s_Base : %(bases)s
+{
+public:
+	/* Pure virtual functions that need to be implemented in derived class: */
+	virtual uint8_t read8(uint16_t address, uint16_t n=8) = 0;  // 8 bit read
+	virtual void write(uint16_t address, uint8_t value, uint16_t n=8) = 0;  // 8 bit write
+
+	/* Burst transfers of consecutive registers, override if the bus supports auto-increment: */
+	virtual void readBurst(uint16_t address, uint8_t *data, uint16_t count);  // default: count x read8
+	virtual void writeBurst(uint16_t address, const uint8_t *data, uint16_t count);  // default: count x write
+
+	virtual ~%(D)s_Base() {}
+
+	/* Snapshot of the configuration registers, see %(D)s_Core.hpp */
+	typedef %(D)s_RegisterDump RegisterDump;
+
+	/* Read all configuration registers in one burst */
+	void dumpRegisters(RegisterDump &dump);
+
+	/*
+	 * Write back a snapshot. Only registers that differ from the device are written,
+	 * consecutive ones in a single burst. STATUS (SPI page select) is left to the bus
+	 * implementation and Ctrl_meas is restored in SLEEP mode so no measurement is started;
+	 * it is also written when only Ctrl_hum changed, which takes effect on that write.
+	 * Returns the number of registers written.
+	 */
+	uint16_t restoreRegisters(const RegisterDump &dump);
+};'''
+
+GROUP_REGISTERS = '''\
+/*
+ * %(title)s registers of %(D)s_Base: %(doc)s.
+ * Include this header alone where only the constants are needed:
+ * %(D)s_%(Group)sRegisters::%(example)s is %(D)s_Base::%(example)s.
+ */
+struct %(D)s_%(Group)sRegisters
+{'''
+
+GROUP_ACCESS = '''\
+/* Set/get accessors of the %(group)s registers, D implements read8 and write */
+template <class D>
+class %(D)s_%(Group)sAccess : public %(D)s_%(Group)sRegisters
+{
+public:'''
+
+TEMPLATE_CLASS = '''\
+/*
+ * Register layer bound at compile time. Derive the bus class as
+ *
+ *   class Bus : public %(D)s_StaticBase<Bus>
+ *
+ * and implement read8 and write as ordinary members with the signatures of %(D)s_Base.
+ * The accessors call them directly and inline, there is no vtable. Not interchangeable
+ * with %(D)s_Base: the drivers of the other modules take a %(D)s_Base.
+ */
+template <class D>
+class %(D)s_StaticBase : %(bases)s
+{
+public:
+	/* Default burst transfers, hidden by members of the same name in D */
+	void readBurst(uint16_t address, uint8_t *data, uint16_t count)
+	{
+		for (uint16_t i = 0; i < count; i++)
+			data[i] = static_cast<D *>(this)->read8((uint16_t)(address + i), 8);
+	}
+
+	void writeBurst(uint16_t address, const uint8_t *data, uint16_t count)
+	{
+		for (uint16_t i = 0; i < count; i++)
+			static_cast<D *>(this)->write((uint16_t)(address + i), data[i], 8);
+	}
+
+protected:
+	~%(D)s_StaticBase() {}
+};'''
+
+TABLE_CLASS = '''\
+/*
+ * Table driven register layer: one out of line accessor for all registers and fields,
+ * addressed by the constants of %(D)s_Reg and %(D)s_Field, so every access compiles to
+ * a call with a constant argument:
+ *
+ *   dev.setField(%(D)s_Field::Ctrl_meas_osrs_t, %(D)s_TableBase::Ctrl_meas::osrs_t::X2);
+ *
+ * Derive from class %(D)s_TableBase and implement the read and write functions.
+ */
+
+/* Register index */
+struct %(D)s_Reg
+{
+	enum
+	{
+%(regs)s
+		COUNT
+	};
+};
+
+/* Field index */
+struct %(D)s_Field
+{
+	enum
+	{
+%(fields)s
+		COUNT
+	};
+};
+
+class %(D)s_TableBase : %(bases)s
+{
+public:
+	/* Pure virtual functions that need to be implemented in derived class: */
+	virtual uint8_t read8(uint16_t address, uint16_t n=8) = 0;  // 8 bit read
+	virtual void write(uint16_t address, uint8_t value, uint16_t n=8) = 0;  // 8 bit write
+
+	virtual ~%(D)s_TableBase() {}
+
+	/* Register by %(D)s_Reg index */
+	uint8_t get(uint8_t reg);
+	/* Returns false and does not write if the register is read only */
+	bool set(uint8_t reg, uint8_t value);
+
+	/* Field by %(D)s_Field index, value not shifted (like the enumerated values) */
+	uint8_t getField(uint8_t field);
+	/* Read-modify-write of the register, returns false if it is read only */
+	bool setField(uint8_t field, uint8_t value);
+
+	/* Constant tables, indexed by %(D)s_Reg and %(D)s_Field */
+	static const uint8_t address[%(D)s_Reg::COUNT];
+	static const uint8_t writable[(%(D)s_Reg::COUNT + 7) / 8];
+	static const uint8_t fieldRegister[%(D)s_Field::COUNT];
+	static const uint8_t fieldMask[%(D)s_Field::COUNT];
+	static const uint8_t fieldShift[%(D)s_Field::COUNT];
+};'''
+
+TABLE_SOURCE = '''\
+#include "%(D)s_TableBase.hpp"
+
+const uint8_t %(D)s_TableBase::address[%(D)s_Reg::COUNT] =
+{
+%(address)s
+};
+
+const uint8_t %(D)s_TableBase::writable[(%(D)s_Reg::COUNT + 7) / 8] =
+{
+%(writable)s
+};
+
+const uint8_t %(D)s_TableBase::fieldRegister[%(D)s_Field::COUNT] =
+{
+%(fieldRegister)s
+};
+
+const uint8_t %(D)s_TableBase::fieldMask[%(D)s_Field::COUNT] =
+{
+%(fieldMask)s
+};
+
+const uint8_t %(D)s_TableBase::fieldShift[%(D)s_Field::COUNT] =
+{
+%(fieldShift)s
+};
+
+uint8_t %(D)s_TableBase::get(uint8_t reg)
+{
+	return read8(address[reg], 8);
+}
+
+bool %(D)s_TableBase::set(uint8_t reg, uint8_t value)
+{
+	if (!(writable[reg >> 3] & (1 << (reg & 7))))
+		return false;
+	write(address[reg], value, 8);
+	return true;
+}
+
+uint8_t %(D)s_TableBase::getField(uint8_t field)
+{
+	return (uint8_t)((get(fieldRegister[field]) & fieldMask[field]) >> fieldShift[field]);
+}
+
+bool %(D)s_TableBase::setField(uint8_t field, uint8_t value)
+{
+	uint8_t reg = fieldRegister[field];
+	uint8_t mask = fieldMask[field];
+	if (!(writable[reg >> 3] & (1 << (reg & 7))))
+		return false;
+	write(address[reg], (uint8_t)((get(reg) & ~mask) | ((value << fieldShift[field]) & mask)), 8);
+	return true;
+}
+'''
+
+
+def class_lines(text):
+	"""Blank lines in a class body are indented like the next line, as in the rest of the generated code"""
+	lines = text.split('\n')
+	depth = 0
+	for i, line in enumerate(lines):
+		depth += line.count('{') - line.count('}')
+		if not line and depth > 0:
+			following = lines[i + 1]
+			lines[i] = following[:len(following) - len(following.lstrip('\t'))] or '\t'
+	return lines
+
+
+def values(device):
+	return {'D': device.name, 'description': device.meta['description']}
+
+
+def group_values(device, group):
+	v = values(device)
+	v.update({'group': group.name, 'Group': group.name.capitalize(), 'title': group.name.capitalize(),
+		'doc': group.doc[0][0].lower() + group.doc[0][1:] if group.doc else group.name,
+		'example': group.registers[0].name + '::__address'})
+	return v
+
+
+def group_header(device, group):
+	return '%s_%sRegisters.hpp' % (device.name, group.name.capitalize())
+
+
+def bases(device, pattern):
+	names = [pattern % (device.name, g.name.capitalize()) for g in device.groups]
+	return ', '.join('public ' + n for n in names)
+
+
+def wrap(text, indent='\t'):
+	"""Break a base class list after a comma before the line gets longer than 100 characters"""
+	lines = []
+	line = ''
+	for part in text.split(', '):
+		if line and len(line) + len(part) + 2 > 100:
+			lines.append(line + ',')
+			line = indent + part
+		else:
+			line = line + ', ' + part if line else part
+	return '\n'.join(lines + [line])
+
+
+def header_file(device, name, body, includes=(), chisl=False):
+	guard = name.upper().replace('.', '_')
+	lines = file_header(device, name, chisl)
+	lines += ['#ifndef ' + guard, '#define ' + guard, '', '#include <cinttypes>']
+	lines += ['#include "%s"' % i for i in includes] + ['']
+	lines += body
+	lines += ['', '#endif', '']
+	return '\n'.join(lines)
+
+
+def generate_groups(device):
+	files = {}
+	for group in device.groups:
+		v = group_values(device, group)
+		body = class_lines(GROUP_REGISTERS % v) + register_blocks(group.registers) + ['};', '']
+		body += class_lines(GROUP_ACCESS % v)
+		body += accessor_blocks(group.registers, 'static_cast<D *>(this)->write', 'static_cast<D *>(this)->read8')
+		body += ['};']
+		files[group_header(device, group)] = header_file(device, group_header(device, group), body)
+	return files
+
+
+REGISTER_TABLE = '''\
+/*
+ * Register map tables of %(D)s_Registers.hpp, generated from the same description as
+ * the register structs. Masks, defaults and enumerated values refer to the constants of
+ * %(D)s_Base, the lookup functions are in %(D)s_Registers.cpp.
+ */
+
+#include "%(D)s.hpp"
+#include "%(D)s_Registers.hpp"
+
+%(tables)s
+const %(D)s_RegisterInfo %(D)s_registers[] =
+{
+%(registers)s
+};
+const uint8_t %(D)s_registerCount = %(count)d;
+
+const uint8_t %(D)s_registerIndex[256] =
+{
+%(index)s
+};
+'''
+
+ACCESS = {'r': 'READ', 'w': 'WRITE', 'rw': 'READ_WRITE'}
+
+
+def generate_register_table(device):
+	"""Constant register map of BME680_Registers.hpp, registers sorted by address"""
+	d = device.name
+	registers = sorted(device.registers, key=lambda r: r.address)
+	tables = []
+	for r in registers:
+		for f in r.fields:
+			if f.enums:
+				tables += ['static const %s_EnumInfo %s_values_%s_%s[] =' % (d, d, r.name, f.name), '{']
+				tables.append(',\n'.join('\t{ "%s", %s_Base::%s::%s::%s }' % (e[0], d, r.name, r.struct(f), e[0])
+					for e in f.enums))
+				tables += ['};', '']
+	for r in registers:
+		entries = []
+		for f in r.fields:
+			name = r.struct(f)
+			enums = ('%s_values_%s_%s, %d' % (d, r.name, f.name, len(f.enums))) if f.enums else '0, 0'
+			entries.append('\t{ "%s", %s_Base::%s::%s::mask, %s_Base::%s::%s::dflt, %s }' % (
+				name, d, r.name, name, d, r.name, name, enums))
+		tables += ['static const %s_FieldInfo %s_fields_%s[] =' % (d, d, r.name), '{', ',\n'.join(entries), '};', '']
+	index = [0] * 256
+	for i, r in enumerate(registers):
+		index[r.address] = i + 1
+	v = values(device)
+	v.update({
+		'tables': '\n'.join(tables),
+		'registers': ',\n'.join('\t{ %s_Base::%s::__address, "%s", %s_Access::%s, %s_fields_%s, %d }' % (
+			d, r.name, r.name, d, ACCESS[r.access], d, r.name, len(r.fields)) for r in registers),
+		'count': len(registers),
+		'index': rows(['%d' % i for i in index], 16),
+	})
+	name = d + '_RegisterTable.cpp'
+	return {name: '\n'.join(file_header(device, name)) + '\n' + REGISTER_TABLE % v}
+
+
+def generate_virtual(device):
+	v = values(device)
+	v['bases'] = wrap(bases(device, '%s_%sAccess<' + device.name + '_Base>'))
+	name = device.name + '.hpp'
+	includes = [device.name + '_Core.hpp'] + [group_header(device, g) for g in device.groups]
+	files = generate_groups(device)
+	files.update(generate_register_table(device))
+	files[name] = header_file(device, name, class_lines(VIRTUAL_CLASS % v), includes, True)
+	return files
+
+
+def generate_template(device):
+	v = values(device)
+	v['bases'] = wrap(bases(device, '%s_%sAccess<D>'))
+	name = device.name + '_StaticBase.hpp'
+	includes = [group_header(device, g) for g in device.groups]
+	return {name: header_file(device, name, class_lines(TEMPLATE_CLASS % v), includes)}
+
+
+def table_fields(device):
+	return [(r, i, f) for i, r in enumerate(device.registers) for f in r.fields]
+
+
+def rows(items, per_row):
+	chunks = [items[i:i + per_row] for i in range(0, len(items), per_row)]
+	return ',\n'.join('\t' + ', '.join(c) for c in chunks)
+
+
+def generate_table(device):
+	v = values(device)
+	v['regs'] = '\n'.join('\t\t%s,' % r.name for r in device.registers)
+	v['fields'] = '\n'.join('\t\t%s_%s,' % (r.name, f.name) for r, i, f in table_fields(device))
+	v['bases'] = wrap(bases(device, '%s_%sRegisters'))
+	header = device.name + '_TableBase.hpp'
+	includes = [group_header(device, g) for g in device.groups]
+	source = device.name + '_TableBase.cpp'
+
+	flags = [0] * ((len(device.registers) + 7) // 8)
+	for i, r in enumerate(device.registers):
+		if 'w' in r.access:
+			flags[i >> 3] |= 1 << (i & 7)
+	fields = table_fields(device)
+	v['address'] = rows(['%d' % r.address for r in device.registers], 16)
+	v['writable'] = rows(['0x%02x' % f for f in flags], 16)
+	v['fieldRegister'] = rows(['%d' % i for r, i, f in fields], 16)
+	v['fieldMask'] = rows(['0x%02x' % f.mask for r, i, f in fields], 16)
+	v['fieldShift'] = rows(['%d' % f.lsb for r, i, f in fields], 16)
+	text = '\n'.join(file_header(device, source)) + '\n' + TABLE_SOURCE % v
+	return {
+		header: header_file(device, header, class_lines(TABLE_CLASS % v), includes),
+		source: text,
+	}
+
+
+GENERATORS = {
+	'virtual': generate_virtual,
+	'template': generate_template,
+	'table': generate_table,
+}
+
+# Translation unit calling every accessor once, compiled for the code size report
+PROBE = {
+	'virtual': '''\
+#include "%(D)s.hpp"
+void %(D)s_probe(%(D)s_Base &dev, uint8_t *v)
+{
+%(calls)s
+}
+''',
+	'template': '''\
+#include "%(D)s_StaticBase.hpp"
+class Bus : public %(D)s_StaticBase<Bus>
+{
+public:
+	uint8_t read8(uint16_t address, uint16_t n=8);
+	void write(uint16_t address, uint8_t value, uint16_t n=8);
+};
+void %(D)s_probe(Bus &dev, uint8_t *v)
+{
+%(calls)s
+}
+''',
+	'table': '''\
+#include "%(D)s_TableBase.hpp"
+void %(D)s_probe(%(D)s_TableBase &dev, uint8_t *v)
+{
+%(calls)s
+}
+''',
+}
+
+
+def probe_calls(device, api):
+	calls = []
+	for n, r in enumerate(device.registers):
+		if api == 'table':
+			calls.append('\tv[%d] = dev.get(%s_Reg::%s);' % (n, device.name, r.name))
+			calls.append('\tdev.set(%s_Reg::%s, v[%d]);' % (device.name, r.name, n))
+		else:
+			calls.append('\tv[%d] = dev.get%s();' % (n, r.name))
+			calls.append('\tdev.set%s(v[%d]);' % (r.name, n))
+	return '\n'.join(calls)
+
+
+def size_report(device, apis, root):
+	cxx = os.environ.get('CXX', 'g++')
+	flags = os.environ.get('CXXFLAGS', '-Os').split()
+	work = tempfile.mkdtemp(prefix='bme680_gen_')
+	try:
+		print('%-10s %8s %8s %8s  (%s %s, %d registers, every accessor called once)' % (
+			'api', 'text', 'data', 'bss', cxx, ' '.join(flags), len(device.registers)))
+		for api in apis:
+			files = GENERATORS[api](device)
+			files.pop(device.name + '_RegisterTable.cpp', None)  # introspection data, not part of the accessors
+			headers = generate_groups(device)
+			headers.update(files)
+			v = values(device)
+			v['calls'] = probe_calls(device, api)
+			files['probe.cpp'] = headers['probe.cpp'] = PROBE[api] % v
+			total = [0, 0, 0]
+			for name, text in headers.items():
+				with open(os.path.join(work, name), 'w', encoding='utf-8') as f:
+					f.write(text)
+			for name in files:
+				if not name.endswith('.cpp'):
+					continue
+				obj = os.path.join(work, name[:-4] + '.o')
+				subprocess.check_call([cxx] + flags + ['-c', '-I', work, '-I', root, os.path.join(work, name), '-o', obj])
+				out = subprocess.check_output(['size', obj]).decode().split('\n')[1].split()
+				total = [t + int(o) for t, o in zip(total, out[:3])]
+			print('%-10s %8d %8d %8d' % (api, total[0], total[1], total[2]))
+	finally:
+		shutil.rmtree(work)
+
+
+def main():
+	root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+	parser = argparse.ArgumentParser(description='Generate the BME680 register layer')
+	parser.add_argument('description', nargs='?', default=os.path.join(root, 'gen', 'BME680.regs'))
+	parser.add_argument('--api', choices=sorted(GENERATORS) + ['all'], default='virtual')
+	parser.add_argument('--output', default=root, help='output directory (default: repository root)')
+	parser.add_argument('--check', action='store_true', help='compare with the files in the output directory')
+	parser.add_argument('--size', action='store_true', help='report the code size of each variant')
+	args = parser.parse_args()
+
+	device = parse(args.description)
+	apis = sorted(GENERATORS) if args.api == 'all' else [args.api]
+	if args.size:
+		size_report(device, apis, root)
+		return 0
+
+	status = 0
+	if not args.check and not os.path.isdir(args.output):
+		os.makedirs(args.output)
+	for api in apis:
+		for name, text in sorted(GENERATORS[api](device).items()):
+			path = os.path.join(args.output, name)
+			if args.check:
+				current = open(path, encoding='utf-8').read() if os.path.exists(path) else None
+				if current != text:
+					print('%s differs from %s' % (path, args.description))
+					status = 1
+			else:
+				with open(path, 'w', encoding='utf-8') as f:
+					f.write(text)
+				print('wrote ' + path)
+	return status
+
+
+if __name__ == '__main__':
+	sys.exit(main())
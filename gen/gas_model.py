@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+#
+# name:        BME680
+# description: Low-power gas, pressure, temperature and humidity sensor
+# manuf:       Bosch Sensortec
+# version:     0.1
+# url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+# file:        gen/gas_model.py
+#
+"""Quantize a float gas classifier into a BME680_GasClassifier blob.
+
+The model is a JSON file with the feature standardization and the layers of a
+linear model or MLP trained on BME680_GasFeatureBank rows:
+
+  {
+    "mean": [...], "std": [...],                      one per feature
+    "layers": [{"weights": [[...], ...],              outputs x inputs
+                "bias": [...],
+                "activation": "relu" | "linear"}],    the last layer gives class scores
+    "samples": [[...], ...]                           optional feature rows
+  }
+
+Standardized inputs are clipped to +-CLIP and quantized to int8, weights are
+quantized per output. The range of each hidden layer is taken from the samples
+if given, otherwise from a bound over the weights. With samples, the classes of
+the quantized model are compared with those of the float model.
+
+Usage:
+
+  gen/gas_model.py model.json model.bin [--clip 4]
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b'BME680M1'
+ACTIVATIONS = {'linear': 0, 'relu': 1}
+
+
+def saturate(x):
+	q = int(x - 0.5) if x < 0 else int(x + 0.5)
+	return max(-127, min(127, q))
+
+
+def forward(layers, row):
+	"""Float model, returns the activations of every layer"""
+	result = []
+	for layer in layers:
+		out = []
+		for w, b in zip(layer['weights'], layer['bias']):
+			y = b + sum(wi * xi for wi, xi in zip(w, row))
+			if layer.get('activation', 'linear') == 'relu':
+				y = max(0.0, y)
+			out.append(y)
+		result.append(out)
+		row = out
+	return result
+
+
+def quantize(model, clip):
+	mean, std, layers = model['mean'], model['std'], model['layers']
+	samples = [[(x - m) / s for x, m, s in zip(row, mean, std)] for row in model.get('samples', [])]
+	ranges = [0.0] * len(layers)
+	for row in samples:
+		for l, out in enumerate(forward(layers, [max(-clip, min(clip, x)) for x in row])):
+			ranges[l] = max([ranges[l]] + [abs(y) for y in out])
+
+	step = clip / 127.0
+	quantized = {'mean': mean, 'scale': [1.0 / (s * step) for s in std], 'layers': []}
+	bound = clip
+	for l, layer in enumerate(layers):
+		last = l + 1 == len(layers)
+		weights, bias = layer['weights'], layer['bias']
+		if not samples:
+			ranges[l] = max(sum(abs(w) for w in row) * bound + abs(b) for row, b in zip(weights, bias))
+		bound = ranges[l] or 1.0
+		out_step = bound / 127.0
+		entry = {'activation': ACTIVATIONS[layer.get('activation', 'linear')], 'multiplier': [], 'bias': [], 'weights': []}
+		for row, b in zip(weights, bias):
+			w_step = (max(abs(w) for w in row) / 127.0) or 1.0
+			entry['weights'].append([saturate(w / w_step) for w in row])
+			entry['bias'].append(int(round(b / (step * w_step))))
+			entry['multiplier'].append(step * w_step / (1.0 if last else out_step))
+		quantized['layers'].append(entry)
+		step = out_step
+	return quantized, samples
+
+
+def classify(quantized, row):
+	"""Same arithmetic as BME680_GasClassifier::classify (float32 rounding aside)"""
+	q = [saturate((x - m) * s) for x, m, s in zip(row, quantized['mean'], quantized['scale'])]
+	for l, layer in enumerate(quantized['layers']):
+		out = []
+		for w, b, m in zip(layer['weights'], layer['bias'], layer['multiplier']):
+			acc = b + sum(wi * qi for wi, qi in zip(w, q))
+			if layer['activation'] == 1:
+				acc = max(0, acc)
+			out.append(acc * m)
+		q = out if l + 1 == len(quantized['layers']) else [saturate(y) for y in out]
+	return q.index(max(q))
+
+
+def blob(quantized):
+	data = bytearray(MAGIC)
+	data += struct.pack('<BBxx', len(quantized['mean']), len(quantized['layers']))
+	data += struct.pack('<%df' % len(quantized['mean']), *quantized['mean'])
+	data += struct.pack('<%df' % len(quantized['scale']), *quantized['scale'])
+	for layer in quantized['layers']:
+		n = len(layer['bias'])
+		data += struct.pack('<BBxx', n, layer['activation'])
+		data += struct.pack('<%df' % n, *layer['multiplier'])
+		data += struct.pack('<%di' % n, *layer['bias'])
+		weights = bytearray(struct.pack('<%db' % sum(len(r) for r in layer['weights']), *sum(layer['weights'], [])))
+		data += weights + bytes(-len(weights) % 4)
+	return bytes(data)
+
+
+def main():
+	parser = argparse.ArgumentParser(description='Quantize a gas classifier for BME680_GasClassifier')
+	parser.add_argument('model', help='float model (JSON)')
+	parser.add_argument('output', help='model blob')
+	parser.add_argument('--clip', type=float, default=4.0, help='range of the standardized inputs (default: 4)')
+	args = parser.parse_args()
+
+	with open(args.model) as f:
+		model = json.load(f)
+	quantized, samples = quantize(model, args.clip)
+	data = blob(quantized)
+	with open(args.output, 'wb') as f:
+		f.write(data)
+	print('%s: %d inputs, %d layers, %d classes, %d bytes' % (args.output, len(model['mean']),
+		len(model['layers']), len(model['layers'][-1]['bias']), len(data)))
+	if samples:
+		same = 0
+		for raw, row in zip(model['samples'], samples):
+			scores = forward(model['layers'], [max(-args.clip, min(args.clip, x)) for x in row])[-1]
+			same += classify(quantized, raw) == scores.index(max(scores))
+		print('samples: %d, same class as the float model: %d (%.1f %%)' % (len(samples), same, 100.0 * same / len(samples)))
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+#
+# name:        BME680
+# description: Low-power gas, pressure, temperature and humidity sensor
+# manuf:       Bosch Sensortec
+# version:     0.1
+# url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+# file:        gen/parse_bench.py
+#
+"""Front end time per translation unit, before and after a change of the headers.
+
+Every .cpp of the tree and every header on its own (a translation unit with
+the single #include) is compiled with -fsyntax-only, the median of --runs runs
+is reported in ms for:
+
+  before   the tree at git revision --before (default HEAD)
+  after    the working tree
+  pch      the working tree with BME680_Pch.hpp precompiled and forced into
+           every translation unit (-include), as a build would do it
+
+Usage:
+
+  gen/parse_bench.py [--before REV] [--runs N] [--filter TEXT]
+
+$CXX (default g++) and $CXXFLAGS (default empty) select the compiler.
+"""
+
+import argparse
+import glob
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def checkout(root, revision, target):
+	archive = subprocess.check_output(['git', '-C', root, 'archive', revision])
+	subprocess.run(['tar', '-x', '-C', target], input=archive, check=True)
+
+
+def units(tree):
+	"""Translation units: the sources, and a one-line unit per header"""
+	result = {}
+	for path in sorted(glob.glob(os.path.join(tree, '*.cpp'))):
+		result[os.path.basename(path)] = path
+	probes = os.path.join(tree, '.probe')
+	os.mkdir(probes)
+	for path in sorted(glob.glob(os.path.join(tree, '*.hpp')) + glob.glob(os.path.join(tree, '*.h'))):
+		name = os.path.basename(path)
+		if name == 'BME680_Pch.hpp':
+			continue
+		probe = os.path.join(probes, name + '.cpp')
+		with open(probe, 'w') as f:
+			f.write('#include "%s"\n' % name)
+		result[name] = probe
+	return result
+
+
+def measure(command, runs):
+	times = []
+	for i in range(runs):
+		start = time.perf_counter()
+		result = subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+		times.append(time.perf_counter() - start)
+		if result.returncode:
+			return None
+	return sorted(times)[len(times) // 2] * 1000
+
+
+def main():
+	root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+	parser = argparse.ArgumentParser(description='Front end time per translation unit')
+	parser.add_argument('--before', default='HEAD', help='git revision to compare with (default: HEAD)')
+	parser.add_argument('--runs', type=int, default=5)
+	parser.add_argument('--filter', default='', help='only units whose name contains TEXT')
+	args = parser.parse_args()
+
+	cxx = os.environ.get('CXX', 'g++')
+	flags = os.environ.get('CXXFLAGS', '').split()
+	work = tempfile.mkdtemp(prefix='bme680_bench_')
+	try:
+		before = os.path.join(work, 'before')
+		after = os.path.join(work, 'after')
+		os.mkdir(before)
+		checkout(root, args.before, before)
+		shutil.copytree(root, after, ignore=shutil.ignore_patterns('.git', '*.gch'))
+
+		pch = os.path.join(after, 'BME680_Pch.hpp')
+		if os.path.exists(pch):
+			subprocess.check_call([cxx] + flags + ['-I', after, '-x', 'c++-header', pch, '-o', pch + '.gch'])
+		else:
+			pch = None
+
+		old = units(before)
+		new = units(after)
+		print('%-32s %9s %9s %9s  (%s %s, median of %d, ms)' % (
+			'unit', 'before', 'after', 'pch', cxx, ' '.join(flags), args.runs))
+		totals = [0.0, 0.0, 0.0]
+		for name in sorted(set(old) | set(new), key=lambda n: (not n.endswith('.cpp'), n)):
+			if args.filter not in name:
+				continue
+			row = [None, None, None]
+			if name in old:
+				row[0] = measure([cxx] + flags + ['-fsyntax-only', '-I', before, old[name]], args.runs)
+			if name in new:
+				base = [cxx] + flags + ['-fsyntax-only', '-I', after]
+				row[1] = measure(base + [new[name]], args.runs)
+				if pch:
+					row[2] = measure(base + ['-include', pch, new[name]], args.runs)
+			if all(r is not None for r in row):
+				totals = [t + r for t, r in zip(totals, row)]
+			print('%-32s %9s %9s %9s' % ((name,) + tuple('-' if r is None else '%.1f' % r for r in row)))
+		print('%-32s %9.1f %9.1f %9.1f  (units present in both)' % (('total',) + tuple(totals)))
+	finally:
+		shutil.rmtree(work)
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit(main())
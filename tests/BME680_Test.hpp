@@ -0,0 +1,50 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/BME680_Test.hpp
+ */
+
+#ifndef BME680_TEST_HPP
+#define BME680_TEST_HPP
+
+#include <cstdio>
+
+/*
+ * Minimal test support: each test is a function, BME680_CHECK reports a failed
+ * condition with its location and the test continues. BME680_TEST_MAIN runs the
+ * listed tests and returns the number of failures as exit status.
+ *
+ *   static void restoreWritesCtrlMeas() { ... BME680_CHECK(n == 2); }
+ *   BME680_TEST_MAIN(BME680_TEST(restoreWritesCtrlMeas) BME680_TEST(other))
+ */
+
+static int BME680_failures = 0;
+
+static inline void BME680_check(bool ok, const char *condition, const char *file, int line)
+{
+	if (ok)
+		return;
+	fprintf(stderr, "%s:%d: check failed: %s\n", file, line, condition);
+	BME680_failures++;
+}
+
+#define BME680_CHECK(condition) BME680_check((condition), #condition, __FILE__, __LINE__)
+
+#define BME680_TEST(name) \
+	{ \
+		int before = BME680_failures; \
+		name(); \
+		printf("  %-48s %s\n", #name, BME680_failures == before ? "ok" : "FAILED"); \
+	}
+
+#define BME680_TEST_MAIN(tests) \
+	int main() \
+	{ \
+		tests \
+		return BME680_failures ? 1 : 0; \
+	}
+
+#endif
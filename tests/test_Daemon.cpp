@@ -0,0 +1,124 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_Daemon.cpp
+ */
+
+#include <cstdio>
+#include <unistd.h>
+#include "BME680_Test.hpp"
+#include "BME680_Daemon.hpp"
+#include "BME680_Simulator.hpp"
+
+/* Device that never starts a conversion: the FORCED writes are lost */
+class DeadSimulator : public BME680_Simulator
+{
+public:
+	void write(uint16_t address, uint8_t value, uint16_t n=8)
+	{
+		if (address == Ctrl_meas::__address)
+			value &= (uint8_t)~Ctrl_meas::mode::mask;
+		BME680_Simulator::write(address, value, n);
+	}
+};
+
+/* Daemon on the simulator's virtual clock with two connected clients */
+struct Setup
+{
+	char path[64];
+	BME680_Daemon daemon;
+	BME680_DaemonClient a, b;
+
+	Setup(BME680_Simulator &sim)
+		: daemon(sim)
+	{
+		snprintf(path, sizeof(path), "/tmp/bme680-test-%d.sock", (int)getpid());
+		BME680_CHECK(daemon.addSensor(sim, 1000) == 0);
+		BME680_CHECK(daemon.listen(path));
+		BME680_CHECK(a.connect(path));
+		BME680_CHECK(b.connect(path));
+		daemon.poll(0);
+		daemon.poll(0);
+	}
+
+	~Setup() { daemon.close(); }
+
+	void read(BME680_DaemonClient &client, uint16_t tag)
+	{
+		BME680_Message msg;
+		msg.type = BME680_Message::READ;
+		msg.tag = tag;
+		BME680_CHECK(client.send(msg));
+	}
+};
+
+static void readsCoalesce()
+{
+	BME680_Simulator sim;
+	Setup s(sim);
+	s.read(s.a, 1);
+	s.read(s.b, 2);
+	s.daemon.run(50000);
+	BME680_CHECK(s.daemon.cycles == 1);
+	BME680_CHECK(s.daemon.coalesced == 1);
+	BME680_CHECK(sim.conversions == 1);
+
+	BME680_Message msg;
+	BME680_CHECK(s.a.receive(msg, 0));
+	BME680_CHECK(msg.type == BME680_Message::SAMPLE && msg.tag == 1);
+	BME680_CHECK(s.b.receive(msg, 0));
+	BME680_CHECK(msg.type == BME680_Message::SAMPLE && msg.tag == 2);
+	BME680_CHECK(!s.a.receive(msg, 0));
+}
+
+static void readTimesOut()
+{
+	DeadSimulator sim;
+	Setup s(sim);
+	s.read(s.a, 7);
+	s.read(s.b, 8);
+	/* The result is given up 100 ms after the planned end, however often it is polled */
+	s.daemon.run(300000);
+	BME680_CHECK(s.daemon.cycles == 0);
+
+	BME680_Message msg;
+	BME680_CHECK(s.a.receive(msg, 0));
+	BME680_CHECK(msg.type == BME680_Message::ERROR && msg.tag == 7);
+	BME680_CHECK(msg.payload[0] == BME680_Message::READ && msg.payload[1] == BME680_Message::NO_SENSOR);
+	BME680_CHECK(s.b.receive(msg, 0));
+	BME680_CHECK(msg.type == BME680_Message::ERROR && msg.tag == 8);
+	/* One error each, no new measurement for readers that were answered */
+	BME680_CHECK(!s.a.receive(msg, 0));
+	BME680_CHECK(!s.b.receive(msg, 0));
+}
+
+static void samplesReachStats()
+{
+	BME680_Simulator sim;
+	Setup s(sim);
+	BME680_TumblingAggregator minutes(60000);
+	s.daemon.setStats(0, &minutes);
+	for (uint16_t tag = 1; tag <= 2; tag++)
+	{
+		s.read(s.a, tag);
+		s.daemon.run(50000);
+	}
+	BME680_CHECK(s.daemon.cycles == 2);
+	const BME680_ChannelStats &t = minutes.current().channel[BME680_Channel::TEMPERATURE];
+	BME680_CHECK(t.moments.count() == 2);
+	BME680_CHECK(minutes.current().channel[BME680_Channel::GAS].moments.count() == 0);
+
+	s.daemon.setStats(0, 0);
+	s.read(s.a, 3);
+	s.daemon.run(50000);
+	BME680_CHECK(s.daemon.cycles == 3 && t.moments.count() == 2);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(readsCoalesce)
+	BME680_TEST(readTimesOut)
+	BME680_TEST(samplesReachStats)
+)
@@ -0,0 +1,122 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_DutyCycle.cpp
+ */
+
+#include "BME680_Test.hpp"
+#include "BME680_DutyCycle.hpp"
+#include "BME680_Simulator.hpp"
+
+typedef BME680_Base B;
+
+/* Run the scheduler on the simulator's virtual clock until 'until' ms */
+static void runFor(BME680_DutyCycleScheduler &s, BME680_Simulator &sim, uint32_t until, int &cycles, int &gas)
+{
+	while (sim.millis() < until)
+	{
+		uint32_t d = s.run(sim, sim.millis());
+		if (d)
+		{
+			cycles++;
+			if (s.gas())
+				gas++;
+			sim.sleep(d);
+			BME680_CHECK(sim.getmeas_status_0() & B::meas_status_0::new_data_0::mask);
+			/* The heater runs only in the cycles with gas */
+			BME680_CHECK(!(sim.getCtrl_gas_1() & B::Ctrl_gas_1::run_gas::mask) == !s.gas());
+		}
+		uint32_t next = s.next();
+		if ((int32_t)(next - sim.millis()) > 0)
+			sim.sleep((next - sim.millis()) * 1000);
+	}
+}
+
+static void gasOnlyWhenDue()
+{
+	BME680_Simulator sim;
+	BME680_DutyCycleScheduler s;
+	s.setTPH(3000, B::Ctrl_meas::osrs_t::X1, B::Ctrl_meas::osrs_p::X1, B::Ctrl_hum::osrs_h::X1);
+	s.setGas(300000, 0, 150, 0x73);
+	s.configure(sim, sim.millis());
+
+	int cycles = 0, gas = 0;
+	runFor(s, sim, 3600000, cycles, gas);
+	BME680_CHECK(cycles == 1200);
+	BME680_CHECK(gas == 12);
+	BME680_CHECK(sim.conversions == 1200);
+	/* 12 heater phases of 150 ms wait plus the gas conversion */
+	BME680_CHECK(sim.heaterTime >= 12 * 150000ull && sim.heaterTime < 12 * 200000ull);
+}
+
+static void consumedMatchesReport()
+{
+	BME680_Simulator sim;
+	BME680_DutyCycleScheduler s;
+	s.setTPH(3000, B::Ctrl_meas::osrs_t::X2, B::Ctrl_meas::osrs_p::X4, B::Ctrl_hum::osrs_h::X1);
+	s.setGas(60000, 2, 100, 0x73);
+	s.configure(sim, sim.millis());
+
+	int cycles = 0, gas = 0;
+	runFor(s, sim, 3600000, cycles, gas);
+	BME680_DutyCycleScheduler::Report r = s.report();
+	BME680_CHECK(r.cyclesPerHour == cycles);
+	BME680_CHECK(r.gasPerHour == gas);
+	double planned = r.averagePower * 3600.0, consumed = s.consumed(sim.millis());
+	BME680_CHECK(consumed > planned * 0.99 && consumed < planned * 1.01);
+}
+
+static void tphOnly()
+{
+	BME680_Simulator sim;
+	BME680_DutyCycleScheduler s;
+	s.setTPH(1000, B::Ctrl_meas::osrs_t::X1, B::Ctrl_meas::osrs_p::X1, B::Ctrl_hum::osrs_h::X1);
+	s.setGas(0, 0, 0, 0);
+	s.configure(sim, sim.millis());
+
+	int cycles = 0, gas = 0;
+	runFor(s, sim, 60000, cycles, gas);
+	BME680_CHECK(cycles == 60);
+	BME680_CHECK(gas == 0);
+	BME680_CHECK(sim.heaterTime == 0);
+}
+
+static void tphGapsWithGasInBetween()
+{
+	BME680_Simulator sim;
+	BME680_DutyCycleScheduler s;
+	s.setTPH(3000, B::Ctrl_meas::osrs_t::X1, B::Ctrl_meas::osrs_p::X1, B::Ctrl_hum::osrs_h::X1);
+	s.setGas(4000, 0, 100, 0x73);
+	s.configure(sim, sim.millis());
+
+	/* Every cycle measures T/P/H, gas cycles included */
+	uint32_t last = sim.millis(), longest = 0;
+	int cycles = 0;
+	while (sim.millis() < 600000)
+	{
+		uint32_t now = sim.millis();
+		uint32_t d = s.run(sim, now);
+		if (d)
+		{
+			if (cycles++ && now - last > longest)
+				longest = now - last;
+			last = now;
+			sim.sleep(d);
+		}
+		uint32_t next = s.next();
+		if ((int32_t)(next - sim.millis()) > 0)
+			sim.sleep((next - sim.millis()) * 1000);
+	}
+	BME680_CHECK(longest <= 3000);
+	BME680_CHECK(cycles >= 200);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(gasOnlyWhenDue)
+	BME680_TEST(consumedMatchesReport)
+	BME680_TEST(tphOnly)
+	BME680_TEST(tphGapsWithGasInBetween)
+)
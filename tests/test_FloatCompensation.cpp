@@ -0,0 +1,83 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_FloatCompensation.cpp
+ */
+
+#include <cmath>
+#include <cstring>
+#include "BME680_Test.hpp"
+#include "BME680_FloatCompensation.hpp"
+#include "BME680_Simulator.hpp"
+
+static BME680_FloatBank<16> bank;
+
+static void genericPathAccuracy()
+{
+	/* Without -mavx the portable vector extension code runs, four lanes wide */
+#if !defined(__AVX__)
+	BME680_CHECK(strcmp(BME680_floatPath(), "generic") == 0);
+	BME680_CHECK(BME680_FLOAT_WIDTH == 4);
+#endif
+	BME680_Simulator sim;
+	BME680_Calibration cal;
+	cal.read(sim);
+	BME680_FloatAccuracy report;
+	BME680_floatAccuracy(cal, report);
+	for (uint8_t c = 0; c < BME680_Channel::COUNT; c++)
+	{
+		BME680_CHECK(report.samples[c] > 10000);
+		BME680_CHECK(report.maxRelative[c] < 1e-5);
+		BME680_CHECK(report.meanError[c] <= report.maxError[c]);
+	}
+	/* Far below the resolution of the device */
+	BME680_CHECK(report.maxError[BME680_Channel::TEMPERATURE] < 0.001);
+	BME680_CHECK(report.maxError[BME680_Channel::PRESSURE] < 0.1);
+	BME680_CHECK(report.maxError[BME680_Channel::HUMIDITY] < 0.001);
+}
+
+static void partialLanes()
+{
+	BME680_Simulator sim;
+	BME680_Calibration cal;
+	cal.read(sim);
+	BME680_RawSample raw;
+	raw.temperature = 500000;
+	raw.pressure = 350000;
+	raw.humidity = 24000;
+	raw.gas = 600;
+	raw.gasStatus = (uint8_t)(BME680_Base::gas_r_lsb::gas_valid_r::mask | 5);
+	raw.channels = 0x0f;
+	for (uint32_t lane = 0; lane < 16; lane++)
+		bank.setCalibration(lane, cal);
+	for (uint32_t lane = 0; lane < 5; lane++)
+	{
+		raw.temperature += 1000;
+		bank.setRaw(lane, raw);
+	}
+	/* Without temperature, P and H of the lane are invalid */
+	raw.channels = (1 << BME680_Channel::PRESSURE) | (1 << BME680_Channel::HUMIDITY);
+	bank.setRaw(4, raw);
+	bank.compensate(5);
+
+	raw.temperature = 500000;
+	raw.channels = 0x0f;
+	for (uint32_t lane = 0; lane < 4; lane++)
+	{
+		raw.temperature += 1000;
+		BME680_Sample reference;
+		BME680_compensateDouble(cal, raw, reference);
+		BME680_CHECK(fabs(bank.temperature(lane) - reference.value[BME680_Channel::TEMPERATURE]) < 0.001);
+		BME680_CHECK(fabs(bank.pressure(lane) - reference.value[BME680_Channel::PRESSURE]) < 0.1);
+		BME680_CHECK(bank.channels(lane) == 0x0f);
+	}
+	BME680_CHECK(bank.channels(4) == 0);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(genericPathAccuracy)
+	BME680_TEST(partialLanes)
+)
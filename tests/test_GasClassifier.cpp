@@ -0,0 +1,86 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_GasClassifier.cpp
+ */
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "BME680_Test.hpp"
+#include "BME680_GasClassifier.hpp"
+
+/* Model blob in the layout of gen/gas_model.py */
+struct Blob
+{
+	std::vector<uint8_t> data;
+
+	Blob(uint8_t inputs, uint8_t layers)
+	{
+		const char magic[8] = { 'B', 'M', 'E', '6', '8', '0', 'M', '1' };
+		data.assign(magic, magic + 8);
+		u8(inputs); u8(layers); u8(0); u8(0);
+	}
+
+	void u8(uint8_t v) { data.push_back(v); }
+	void i32(int32_t v) { for (int i = 0; i < 4; i++) u8((uint8_t)((uint32_t)v >> (8 * i))); }
+	void f32(float v) { int32_t bits; memcpy(&bits, &v, 4); i32(bits); }
+};
+
+/* 2 inputs, 2 classes: class 1 when input 0 is large, input 1 is ignored */
+static void linear(Blob &b)
+{
+	b.f32(0.0f); b.f32(0.0f); // mean
+	b.f32(1.0f); b.f32(1.0f); // scale
+	b.u8(2); b.u8(0); b.u8(0); b.u8(0);
+	b.f32(1.0f); b.f32(1.0f); // multiplier
+	b.i32(0); b.i32(0); // bias
+	b.u8(0); b.u8(0); // weights of class 0
+	b.u8(1); b.u8(0); // weights of class 1
+}
+
+static void saturatesInputs()
+{
+	Blob b(2, 1);
+	linear(b);
+	BME680_GasClassifier model;
+	BME680_CHECK(model.load(&b.data[0], (uint32_t)b.data.size()));
+
+	float scores[2];
+	float row[2] = { 1e30f, 0.0f };
+	BME680_CHECK(model.classify(row, scores) == 1);
+	BME680_CHECK(scores[1] == 127.0f);
+	row[0] = -INFINITY;
+	model.classify(row, scores);
+	BME680_CHECK(scores[1] == -127.0f);
+	row[0] = 126.6f;
+	model.classify(row, scores);
+	BME680_CHECK(scores[1] == 127.0f);
+	row[0] = -3.5f;
+	model.classify(row, scores);
+	BME680_CHECK(scores[1] == -4.0f);
+
+	/* NaN counts as the mean */
+	row[0] = NAN;
+	model.classify(row, scores);
+	BME680_CHECK(scores[1] == 0.0f);
+}
+
+static void rejectsDamagedBlob()
+{
+	Blob b(2, 1);
+	linear(b);
+	BME680_GasClassifier model;
+	BME680_CHECK(!model.load(&b.data[0], (uint32_t)b.data.size() - 4));
+	BME680_CHECK(model.classes() == 0);
+	b.data[0] = 'X';
+	BME680_CHECK(!model.load(&b.data[0], (uint32_t)b.data.size()));
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(saturatesInputs)
+	BME680_TEST(rejectsDamagedBlob)
+)
@@ -0,0 +1,64 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_GasFeatures.cpp
+ */
+
+#include <cmath>
+#include "BME680_Test.hpp"
+#include "BME680_GasFeatures.hpp"
+
+static bool zero(const float *out, uint32_t n)
+{
+	for (uint32_t f = 0; f < n; f++)
+		if (out[f] != 0.0f)
+			return false;
+	return true;
+}
+
+static void rejectsBadShapes()
+{
+	float matrix[2 * 12] = { 0 };
+	float out[32];
+	for (uint32_t f = 0; f < 32; f++)
+		out[f] = 1.0f;
+	BME680_CHECK(!BME680_gasFeatures(matrix, 0, 4, out, 16));
+	BME680_CHECK(zero(out, 16));
+	out[0] = 1.0f;
+	BME680_CHECK(!BME680_gasFeatures(matrix, 2, 11, out, 32));
+	BME680_CHECK(zero(out, 32));
+	BME680_CHECK(!BME680_gasFeatures(matrix, 2, 1, out, 16));
+	BME680_CHECK(!BME680_gasFeatures(matrix, 2, 10, out, 16));
+	BME680_CHECK(BME680_gasFeatures(matrix, 2, 4, out, 16));
+}
+
+static void profileFeatures()
+{
+	static BME680_GasFeatureBank<2, 3, 2> bank;
+	/* R halves from step to step */
+	for (int p = 0; p < 2; p++)
+		for (uint8_t s = 0; s < 3; s++)
+			bank.add(1, s, 80000.0 / (1 << s));
+	BME680_CHECK(bank.profiles == 2 && bank.window(1) == 2);
+	const float *f = bank.features(1);
+	BME680_CHECK(fabs(f[BME680_GasFeature::RATIO(1)] + log(2.0)) < 1e-5);
+	BME680_CHECK(fabs(f[BME680_GasFeature::NORMALIZED(2, 3)] + 2 * log(2.0)) < 1e-5);
+	BME680_CHECK(fabs(f[BME680_GasFeature::SLOPE(3)] + log(2.0)) < 1e-5);
+	BME680_CHECK(fabs(f[BME680_GasFeature::LEVEL(3)] - log(80000.0)) < 1e-4);
+	BME680_CHECK(zero(f + 6, 10));
+	BME680_CHECK(zero(bank.features(0), 16));
+	BME680_CHECK(((uintptr_t)bank.features() & 63) == 0);
+
+	/* An interrupted profile is dropped */
+	bank.add(1, 0, 1000.0);
+	bank.add(1, 2, 1000.0);
+	BME680_CHECK(bank.dropped == 1 && bank.profiles == 2);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(rejectsBadShapes)
+	BME680_TEST(profileFeatures)
+)
@@ -0,0 +1,138 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_GasWaitTuner.cpp
+ */
+
+#include "BME680_Test.hpp"
+#include "BME680_GasFeatures.hpp"
+#include "BME680_GasWaitTuner.hpp"
+#include "BME680_Simulator.hpp"
+#include "BME680_Timing.hpp"
+
+static void findsSettleTime()
+{
+	BME680_Simulator sim;
+	BME680_Measurement meas(sim);
+	BME680_GasWaitTuner tuner(meas, sim);
+	sim.setHeaterSettleTime(85);
+	tuner.setTrials(3);
+	tuner.setMargin(0);
+	uint8_t code = tuner.tuneStep(sim, 2, 0x73);
+	/* The shortest encodable wait of at least 85 ms */
+	BME680_CHECK(BME680_Timing::gasWait(code) == 88);
+	BME680_CHECK(sim.getGas_wait_2() == code);
+	BME680_CHECK(sim.getRes_heat_2() == 0x73);
+	/* Bisection: a handful of candidates, not a scan of the codes */
+	BME680_CHECK(tuner.candidates < 16);
+}
+
+static void marginCappedAtLimit()
+{
+	BME680_Simulator sim;
+	BME680_Measurement meas(sim);
+	BME680_GasWaitTuner tuner(meas, sim);
+	sim.setHeaterSettleTime(95);
+	tuner.setTrials(2);
+	tuner.setLimit(101);
+	/* 96 ms + 10 % is above the limit, the margin is cut to 100 ms rather than dropped */
+	uint8_t code = tuner.tuneStep(sim, 0, 0x73);
+	BME680_CHECK(BME680_Timing::gasWait(code) == 100);
+}
+
+static void notStableWithinLimit()
+{
+	BME680_Simulator sim;
+	BME680_Measurement meas(sim);
+	BME680_GasWaitTuner tuner(meas, sim);
+	sim.setHeaterSettleTime(5000);
+	tuner.setLimit(500);
+	BME680_CHECK(tuner.tuneStep(sim, 0, 0x73) == 0);
+	BME680_CHECK(tuner.candidates == 1);
+}
+
+static void tuneProfile()
+{
+	BME680_Simulator sim;
+	BME680_Measurement meas(sim);
+	BME680_GasWaitTuner tuner(meas, sim);
+	sim.setHeaterSettleTime(40);
+	tuner.setTrials(2);
+	tuner.setMargin(0);
+	BME680_GasWaitProfile profile;
+	profile.count = 2;
+	profile.resHeat[0] = 0x60;
+	profile.resHeat[1] = 0x80;
+	BME680_CHECK(tuner.tune(sim, profile) == 2);
+	BME680_CHECK(profile.waitMs(0) == 40 && profile.waitMs(1) == 40);
+}
+
+static void applySkipsUntuned()
+{
+	BME680_Simulator sim;
+	BME680_GasWaitProfile profile;
+	profile.count = 3;
+	profile.resHeat[0] = 1;
+	profile.resHeat[1] = 2;
+	profile.resHeat[2] = 3;
+	profile.gasWait[0] = BME680_Timing::gasWaitCode(50);
+	profile.gasWait[2] = BME680_Timing::gasWaitCode(80);
+
+	BME680_HeaterSequencer seq;
+	uint8_t steps[BME680_GasWaitProfile::STEPS];
+	BME680_CHECK(profile.apply(seq, steps) == 2);
+	BME680_CHECK(steps[0] == 0 && steps[1] == 2);
+	BME680_CHECK(seq.wait(0) == 50 && seq.wait(1) == 80);
+	seq.configure(sim);
+	BME680_CHECK(sim.getRes_heat_0() == 1 && sim.getRes_heat_1() == 3);
+	/* No step with a 0 ms wait */
+	BME680_CHECK(sim.getGas_wait_1() == BME680_Timing::gasWaitCode(80));
+	BME680_CHECK(sim.getGas_wait_2() == 0 && sim.getRes_heat_2() == 0);
+}
+
+static void compactedProfileFeatures()
+{
+	BME680_Simulator sim;
+	BME680_Measurement meas(sim);
+	BME680_GasWaitProfile profile;
+	profile.count = 3;
+	profile.resHeat[0] = 0x60;
+	profile.resHeat[1] = 0x70;
+	profile.resHeat[2] = 0x80;
+	profile.gasWait[0] = BME680_Timing::gasWaitCode(30);
+	profile.gasWait[2] = BME680_Timing::gasWaitCode(30);
+
+	BME680_HeaterSequencer seq;
+	uint8_t steps[BME680_GasWaitProfile::STEPS];
+	uint8_t loaded = profile.apply(seq, steps);
+	seq.configure(sim);
+	/* gas_meas_index_0 counts the loaded steps: a bank of as many steps completes its profiles */
+	static BME680_GasFeatureBank<1, 2, 4> bank;
+	BME680_CHECK(loaded == 2 && bank.FEATURES == 4);
+	for (uint32_t n = 0; n < 6; n++)
+	{
+		BME680_RawSample raw;
+		meas.setGas(seq.current(), seq.waitCode());
+		sim.sleep(meas.start(BME680_Mode::TPHG));
+		BME680_CHECK(meas.fetch(raw) == BME680_ReadStatus::OK);
+		BME680_CHECK(raw.gasIndex() == seq.current());
+		bank.add(0, raw.gasIndex(), 1000.0 * (steps[raw.gasIndex()] + 1));
+		seq.record(sim, raw);
+	}
+	BME680_CHECK(bank.profiles == 3 && bank.dropped == 0);
+	/* ln(R_1 / R_0) of the loaded steps is that of profile steps 2 and 0 */
+	float ratio = bank.features(0)[BME680_GasFeature::RATIO(1)];
+	BME680_CHECK(ratio > 1.0985f && ratio < 1.0987f);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(findsSettleTime)
+	BME680_TEST(marginCappedAtLimit)
+	BME680_TEST(notStableWithinLimit)
+	BME680_TEST(tuneProfile)
+	BME680_TEST(applySkipsUntuned)
+	BME680_TEST(compactedProfileFeatures)
+)
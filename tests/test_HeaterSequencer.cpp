@@ -0,0 +1,109 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_HeaterSequencer.cpp
+ */
+
+#include "BME680_Test.hpp"
+#include "BME680_HeaterSequencer.hpp"
+#include "BME680_Simulator.hpp"
+#include "BME680_Timing.hpp"
+
+typedef BME680_Base B;
+
+/* One gas measurement of the sequencer's current step on the simulator, returns its class */
+static uint8_t cycle(BME680_HeaterSequencer &seq, BME680_Measurement &meas, BME680_Simulator &sim)
+{
+	BME680_RawSample raw;
+	meas.setGas(seq.current(), seq.waitCode());
+	sim.sleep(meas.start(BME680_Mode::TPHG));
+	BME680_CHECK(meas.fetch(raw) == BME680_ReadStatus::OK);
+	return seq.record(sim, raw);
+}
+
+static void extendsUntilStable()
+{
+	BME680_Simulator sim;
+	BME680_Measurement meas(sim);
+	BME680_HeaterSequencer seq;
+	sim.setHeaterSettleTime(80);
+	seq.setStep(0, 0x73, 30);
+	seq.setAdaptation(2, 50);
+	seq.configure(sim);
+
+	int unstable = 0;
+	while (cycle(seq, meas, sim) == BME680_GasClass::NOT_STABLE && unstable < 20)
+		unstable++;
+	/* 30 -> 45 -> 68 -> 104 ms, two failures each */
+	BME680_CHECK(unstable == 6);
+	BME680_CHECK(seq.stats(0).extensions == 3);
+	BME680_CHECK(seq.wait(0) == 104);
+	BME680_CHECK(sim.getGas_wait_0() == seq.waitCode());
+	BME680_CHECK(cycle(seq, meas, sim) == BME680_GasClass::VALID);
+}
+
+static void waitStaysBelowLimit()
+{
+	BME680_Simulator sim;
+	BME680_Measurement meas(sim);
+	BME680_HeaterSequencer seq;
+	sim.setHeaterSettleTime(1000);
+	seq.setStep(0, 0x73, 60);
+	seq.setAdaptation(1, 50, 101);
+	seq.configure(sim);
+
+	for (int i = 0; i < 10; i++)
+		BME680_CHECK(cycle(seq, meas, sim) == BME680_GasClass::NOT_STABLE);
+	/* 60 -> 90 -> 100 ms: 101 ms would be encoded as 104 */
+	BME680_CHECK(seq.wait(0) == 100);
+	BME680_CHECK(seq.stats(0).extensions == 2);
+}
+
+static void resultOfAnotherStep()
+{
+	BME680_Simulator sim;
+	BME680_HeaterSequencer seq;
+	seq.setStep(0, 0x73, 30);
+	seq.setStep(1, 0x80, 30);
+	seq.setAdaptation(1, 50);
+	seq.configure(sim);
+
+	BME680_RawSample raw;
+	raw.status = (uint8_t)(B::meas_status_0::new_data_0::mask | 1);
+	raw.gasStatus = B::gas_r_lsb::gas_valid_r::mask;
+	BME680_CHECK(seq.record(sim, raw) == BME680_GasClass::NOT_VALID);
+	BME680_CHECK(seq.current() == 0);
+	BME680_CHECK(seq.stats(0).samples == 0 && seq.stats(1).samples == 0);
+	BME680_CHECK(seq.wait(0) == 30);
+
+	raw.status = B::meas_status_0::new_data_0::mask;
+	BME680_CHECK(seq.record(sim, raw) == BME680_GasClass::NOT_STABLE);
+	BME680_CHECK(seq.current() == 1);
+	BME680_CHECK(seq.stats(0).notStable == 1);
+}
+
+static void codeAtMost()
+{
+	for (uint32_t ms = 1; ms < 4200; ms++)
+	{
+		/* The longest wait of all codes not above ms */
+		uint32_t best = 0;
+		for (uint32_t c = 0; c < 256; c++)
+		{
+			uint32_t w = BME680_Timing::gasWait((uint8_t)c);
+			if (w <= ms && w > best)
+				best = w;
+		}
+		BME680_CHECK(BME680_Timing::gasWait(BME680_Timing::gasWaitCodeAtMost(ms)) == best);
+	}
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(extendsUntilStable)
+	BME680_TEST(waitStaysBelowLimit)
+	BME680_TEST(resultOfAnotherStep)
+	BME680_TEST(codeAtMost)
+)
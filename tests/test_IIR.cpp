@@ -0,0 +1,104 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_IIR.cpp
+ */
+
+#include <cmath>
+#include "BME680_Test.hpp"
+#include "BME680_IIR.hpp"
+
+static const uint32_t STEPS = 2000;
+
+/* 20 bit ADC values: a slow ramp with noise and a few steps */
+static uint32_t adc(uint32_t n, uint32_t &random)
+{
+	random = random * 1664525u + 1013904223u;
+	uint32_t level = n < 700 ? 300000 : n < 1400 ? 700000 : 150000;
+	return level + n * 20 + (random >> 22);
+}
+
+static void matchesDatasheet()
+{
+	for (uint8_t setting = 0; setting < BME680_IIR::SETTINGS; setting++)
+	{
+		double c = BME680_IIR::coefficient(setting);
+		BME680_CHECK(c + 1 == (1 << setting));
+		BME680_IIRBank<1> bank;
+		bank.setFilter(setting);
+		uint32_t random = setting;
+		double filtered = 0.0, worst = 0.0;
+		for (uint32_t n = 0; n < STEPS; n++)
+		{
+			uint32_t x = adc(n, random), y;
+			bank.update(&x, &y);
+			/* data_filtered = (data_filtered_old * c + data_adc) / (c + 1), started with the first value */
+			filtered = n ? (filtered * c + x) / (c + 1) : x;
+			worst = fmax(worst, fabs(y - filtered));
+		}
+		/* Truncation to whole LSB plus the rounding of the fractional state */
+		BME680_CHECK(worst < 1.0 + (c + 1) / (1 << BME680_IIR::FRACTION_BITS));
+	}
+}
+
+static void batchMatchesScalar()
+{
+	static const uint32_t LANES = 37; // not a multiple of any vector width
+	BME680_IIRBank<LANES> bank;
+	uint64_t state[LANES], primed[LANES], shift[LANES], plain[LANES];
+	uint32_t random = 27, input[LANES], output[LANES];
+	for (uint32_t i = 0; i < LANES; i++)
+	{
+		bank.setFilter(i, (uint8_t)(i % BME680_IIR::SETTINGS));
+		state[i] = primed[i] = 0;
+		shift[i] = i % BME680_IIR::SETTINGS;
+	}
+	uint32_t mismatches = 0;
+	for (uint32_t n = 0; n < STEPS; n++)
+	{
+		for (uint32_t i = 0; i < LANES; i++)
+			input[i] = adc(n, random) + (i << 12);
+		/* One lane restarts while the others keep their memory */
+		if (n == 100)
+			bank.reset(5);
+		bank.update(input, output);
+
+		for (uint32_t i = 0; i < LANES; i++)
+		{
+			/* One lane at a time */
+			uint32_t y;
+			if (n == 100 && i == 5)
+				state[i] = primed[i] = 0;
+			BME680_iirUpdate(&state[i], &primed[i], &shift[i], &input[i], &y, 1);
+			mismatches += y != output[i] || bank.value(i) != y;
+
+			/* The recursion written out with a branch */
+			uint64_t x = (uint64_t)input[i] << BME680_IIR::FRACTION_BITS;
+			plain[i] = n && !(n == 100 && i == 5) ? (plain[i] * BME680_IIR::coefficient((uint8_t)shift[i]) + x) >> shift[i] : x;
+			mismatches += (uint32_t)(plain[i] >> BME680_IIR::FRACTION_BITS) != y;
+		}
+	}
+	BME680_CHECK(mismatches == 0);
+}
+
+static void inputInPlace()
+{
+	BME680_IIRBank<4> bank;
+	bank.setFilter(2);
+	uint32_t data[4] = { 100, 200, 300, 400 };
+	bank.update(data, data);
+	BME680_CHECK(data[0] == 100 && data[3] == 400);
+	uint32_t step[4] = { 500, 600, 700, 800 };
+	bank.update(step, step);
+	/* (100 * 3 + 500) / 4 */
+	BME680_CHECK(step[0] == 200 && bank.value(3) == 500);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(matchesDatasheet)
+	BME680_TEST(batchMatchesScalar)
+	BME680_TEST(inputInPlace)
+)
@@ -0,0 +1,183 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_Measurement.cpp
+ */
+
+#include <cstring>
+#include "BME680_Test.hpp"
+#include "BME680_Measurement.hpp"
+#include "BME680_Record.hpp"
+#include "BME680_Simulator.hpp"
+
+typedef BME680_Base B;
+typedef BME680_ReadStatus S;
+
+/* Device that loses the FORCED writes while 'lossy' is set */
+class LossySimulator : public BME680_Simulator
+{
+public:
+	LossySimulator() : lossy(false) {}
+
+	void write(uint16_t address, uint8_t value, uint16_t n=8)
+	{
+		if (lossy && address == Ctrl_meas::__address)
+			value &= (uint8_t)~Ctrl_meas::mode::mask;
+		BME680_Simulator::write(address, value, n);
+	}
+
+	bool lossy;
+};
+
+static void deliversOnce()
+{
+	BME680_Simulator sim;
+	BME680_Measurement meas(sim);
+	BME680_RawSample raw;
+	uint32_t d = meas.start(BME680_Mode::TPH);
+	BME680_CHECK(meas.fetch(raw) == S::NOT_READY);
+	sim.sleep(d);
+	BME680_CHECK(meas.fetch(raw) == S::OK);
+	BME680_CHECK(raw.channels & (1 << BME680_Channel::TEMPERATURE));
+	BME680_CHECK(meas.fetch(raw) == S::REPEATED);
+}
+
+static void lostForcedWrite()
+{
+	LossySimulator sim;
+	BME680_Measurement meas(sim);
+	BME680_RawSample raw;
+	sim.sleep(meas.start(BME680_Mode::TPH));
+	BME680_CHECK(meas.fetch(raw) == S::OK);
+
+	/* The old result is still there with new_data_0 set, it must not be delivered again */
+	sim.lossy = true;
+	sim.sleep(meas.start(BME680_Mode::TPH));
+	BME680_CHECK(sim.conversions == 1);
+	BME680_CHECK(meas.fetch(raw) == S::REPEATED);
+
+	sim.lossy = false;
+	sim.sleep(meas.start(BME680_Mode::TPH));
+	BME680_CHECK(meas.fetch(raw) == S::OK);
+}
+
+/* Device that is done before the status can be read back, e.g. after a preemption */
+class FastSimulator : public BME680_Simulator
+{
+public:
+	void write(uint16_t address, uint8_t value, uint16_t n=8)
+	{
+		BME680_Simulator::write(address, value, n);
+		if (address == Ctrl_meas::__address && (value & Ctrl_meas::mode::mask) == Ctrl_meas::mode::FORCED)
+			sleep(20000);
+	}
+};
+
+static void finishedBeforeStatusRead()
+{
+	FastSimulator sim;
+	BME680_Measurement meas(sim);
+	BME680_RawSample raw;
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		sim.setRaw(500000 + i, 350000 + i, 24000, 0, 0);
+		meas.start(BME680_Mode::TPH);
+		BME680_CHECK(meas.fetch(raw) == S::OK);
+		BME680_CHECK(raw.temperature == 500000 + i);
+		BME680_CHECK(meas.fetch(raw) == S::REPEATED);
+	}
+	BME680_CHECK(sim.conversions == 3);
+}
+
+static void otherConversionRunning()
+{
+	BME680_Simulator sim;
+	BME680_Measurement meas(sim);
+	BME680_RawSample raw;
+	uint32_t d = meas.start(BME680_Mode::TPH);
+	sim.sleep(d);
+	/* Someone else starts a conversion before ours is read, the registers are being updated */
+	sim.setCtrl_meas((uint8_t)(sim.getCtrl_meas() | B::Ctrl_meas::mode::FORCED));
+	BME680_CHECK(meas.fetch(raw) != S::OK);
+	/* The retrying fetch waits for the registers to settle */
+	BME680_CHECK(meas.fetch(raw, sim, 20, 1000) == S::OK);
+	BME680_CHECK(sim.conversions == 2);
+}
+
+static void tornByHeaterStep()
+{
+	BME680_Simulator sim;
+	BME680_Measurement meas(sim);
+	BME680_RawSample raw;
+	meas.setGas(1, 0x59);
+	sim.setGas_wait_1(0x59);
+	sim.setGas_wait_2(0x59);
+	sim.sleep(meas.start(BME680_Mode::TPHG));
+	BME680_CHECK(meas.fetch(raw) == S::OK);
+	BME680_CHECK(raw.gasIndex() == 1);
+
+	/* The result in the registers belongs to heater step 2 */
+	sim.sleep(meas.start(BME680_Mode::TPHG));
+	sim.setCtrl_gas_1((uint8_t)(B::Ctrl_gas_1::run_gas::mask | 2));
+	sim.setCtrl_meas((uint8_t)(sim.getCtrl_meas() | B::Ctrl_meas::mode::FORCED));
+	sim.sleep(meas.duration(BME680_Mode::TPHG));
+	BME680_CHECK(meas.fetch(raw) == S::TORN);
+}
+
+static void keepsSpiInterrupt()
+{
+	BME680_Simulator sim;
+	sim.setCtrl_hum(B::Ctrl_hum::spi_3w_int_en::mask);
+	BME680_Measurement meas(sim);
+	meas.setOversampling(B::Ctrl_meas::osrs_t::X2, B::Ctrl_meas::osrs_p::X2, B::Ctrl_hum::osrs_h::X4);
+	sim.sleep(meas.start(BME680_Mode::TPH));
+	BME680_CHECK(sim.getCtrl_hum() == (B::Ctrl_hum::spi_3w_int_en::mask | B::Ctrl_hum::osrs_h::X4));
+	/* GAS skips humidity, the interrupt setting stays */
+	sim.sleep(meas.start(BME680_Mode::GAS));
+	BME680_CHECK(sim.getCtrl_hum() == B::Ctrl_hum::spi_3w_int_en::mask);
+}
+
+/* Device with set bits in the unused low nibble of the xlsb registers */
+class XlsbSimulator : public BME680_Simulator
+{
+public:
+	void readBurst(uint16_t address, uint8_t *data, uint16_t count)
+	{
+		BME680_Simulator::readBurst(address, data, count);
+		for (uint16_t i = 0; i < count; i++)
+			if (address + i == press_xlsb::__address || address + i == temp_xlsb::__address)
+				data[i] |= 0x05;
+	}
+};
+
+static void recordKeepsRegisters()
+{
+	XlsbSimulator sim;
+	BME680_Measurement meas(sim);
+	BME680_RawSample raw;
+	sim.setRaw(0x7a123, 0x5c3f1, 0x6543, 0x2ab, 5);
+	sim.sleep(meas.start(BME680_Mode::TPH));
+	BME680_CHECK(meas.fetch(raw) == S::OK);
+	BME680_CHECK(raw.temperature == 0x7a123);
+
+	bme680_record record;
+	BME680_fillRecord(record, 0, 0, raw, BME680_Sample());
+	/* The bytes as read, not rebuilt from the decoded values; gas was not read */
+	uint8_t data[BME680_DataBlock::SIZE] = { 0 };
+	sim.readBurst(BME680_DataBlock::FIRST, data, BME680_DataBlock::TPH_SIZE);
+	BME680_CHECK(record.raw[B::temp_xlsb::__address - BME680_DataBlock::FIRST] & 0x05);
+	BME680_CHECK(!memcmp(record.raw, data, sizeof(data)));
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(deliversOnce)
+	BME680_TEST(lostForcedWrite)
+	BME680_TEST(finishedBeforeStatusRead)
+	BME680_TEST(otherConversionRunning)
+	BME680_TEST(tornByHeaterStep)
+	BME680_TEST(keepsSpiInterrupt)
+	BME680_TEST(recordKeepsRegisters)
+)
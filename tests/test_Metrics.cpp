@@ -0,0 +1,148 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_Metrics.cpp
+ */
+
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include "BME680_Test.hpp"
+#include "BME680_Clock.hpp"
+#include "BME680_Metrics.hpp"
+
+static bme680_record record(int32_t temperature, uint32_t pressure, uint64_t timestamp)
+{
+	bme680_record r;
+	memset(&r, 0, sizeof(r));
+	r.temperature = temperature;
+	r.pressure = pressure;
+	r.timestamp_us = timestamp;
+	r.valid = BME680_RECORD_TEMPERATURE | BME680_RECORD_PRESSURE;
+	return r;
+}
+
+/* Value field of a sample line, e.g. field(text, "bme680_pressure_pascals{sensor=\"a\"} ") */
+static std::string field(const char *text, const char *line)
+{
+	const char *p = strstr(text, line);
+	if (!p)
+		return "";
+	p += strlen(line);
+	return std::string(p, strchr(p, '\n') - p);
+}
+
+/* Positions at which two texts of the same length differ */
+static uint32_t changed(const std::string &a, const char *b, size_t &first, size_t &last)
+{
+	uint32_t n = 0;
+	for (size_t i = 0; i < a.size(); i++)
+		if (a[i] != b[i])
+		{
+			if (!n++)
+				first = i;
+			last = i;
+		}
+	return n;
+}
+
+static void rendersInPlace()
+{
+	static char buffer[8192];
+	BME680_BusStats bus;
+	BME680_Exporter exporter(buffer, sizeof(buffer));
+	BME680_CHECK(exporter.addSensor("a", &bus) == 0);
+	BME680_CHECK(exporter.addSensor("b\"") == 1);
+	BME680_CHECK(exporter.build());
+	size_t length = exporter.length();
+	/* Placeholders until the first render */
+	BME680_CHECK(strstr(exporter.text(), "bme680_temperature_celsius{sensor=\"b\\\"\"} 0000000000\n"));
+	BME680_CHECK(field(exporter.text(), "bme680_bus_errors_total{sensor=\"a\"} ") == "000000000000000");
+
+	exporter.update(0, record(2137, 101325, 1000000));
+	bus.transactions = 12;
+	bus.errors = 3;
+	exporter.render(3500000);
+	BME680_CHECK(exporter.length() == length && strlen(exporter.text()) == length);
+	BME680_CHECK(field(exporter.text(), "bme680_temperature_celsius{sensor=\"a\"} ") == "+000021.37");
+	BME680_CHECK(field(exporter.text(), "bme680_pressure_pascals{sensor=\"a\"} ") == "000101325");
+	BME680_CHECK(field(exporter.text(), "bme680_sample_age_seconds{sensor=\"a\",channel=\"temperature\"} ") == "00000002.500");
+	BME680_CHECK(field(exporter.text(), "bme680_samples_total{sensor=\"a\"} ") == "000000000000001");
+	BME680_CHECK(field(exporter.text(), "bme680_bus_transactions_total{sensor=\"a\"} ") == "000000000000012");
+	BME680_CHECK(field(exporter.text(), "bme680_bus_errors_total{sensor=\"a\"} ") == "000000000000003");
+	BME680_CHECK(field(exporter.text(), "bme680_temperature_celsius{sensor=\"b\\\"\"} ") == "+000000.00");
+
+	/* Only the digits of the changed value are rewritten */
+	std::string before(exporter.text());
+	exporter.update(0, record(-512, 101325, 3500000));
+	exporter.render(3500000);
+	size_t first = 0, last = 0;
+	BME680_CHECK(changed(before, exporter.text(), first, last) > 0);
+	BME680_CHECK(field(exporter.text(), "bme680_temperature_celsius{sensor=\"a\"} ") == "-000005.12");
+	size_t span = strstr(exporter.text(), "bme680_temperature_celsius{sensor=\"a\"} ") - exporter.text()
+		+ strlen("bme680_temperature_celsius{sensor=\"a\"} ");
+	/* The first change is in the temperature digits, the last one in the sample counter */
+	BME680_CHECK(first >= span && first < span + 10);
+	span = strstr(exporter.text(), "bme680_samples_total{sensor=\"a\"} ") - exporter.text()
+		+ strlen("bme680_samples_total{sensor=\"a\"} ");
+	BME680_CHECK(last >= span && last < span + 15);
+	BME680_CHECK(field(exporter.text(), "bme680_sample_age_seconds{sensor=\"a\",channel=\"temperature\"} ") == "00000000.000");
+	BME680_CHECK(field(exporter.text(), "bme680_samples_total{sensor=\"a\"} ") == "000000000000002");
+
+	/* Nothing new: the text stays as it is */
+	before = exporter.text();
+	exporter.render(3500000);
+	BME680_CHECK(changed(before, exporter.text(), first, last) == 0);
+
+	/* Out of range: clamped to the field */
+	exporter.update(0, record(2000000000, 0, 3500000));
+	exporter.render(3500000);
+	BME680_CHECK(field(exporter.text(), "bme680_temperature_celsius{sensor=\"a\"} ") == "+999999.99");
+	BME680_CHECK(exporter.length() == length);
+}
+
+static void silentClientBounded()
+{
+	static char buffer[8192];
+	BME680_Exporter exporter(buffer, sizeof(buffer));
+	exporter.addSensor("a");
+	BME680_CHECK(exporter.build());
+	BME680_MetricsServer server(exporter);
+	BME680_CHECK(server.listen(0));
+	struct sockaddr_in addr;
+	socklen_t size = sizeof(addr);
+	BME680_CHECK(getsockname(server.fd(), (struct sockaddr *)&addr, &size) == 0);
+
+	/* Connected, but the request never comes */
+	int client = socket(AF_INET, SOCK_STREAM, 0);
+	BME680_CHECK(connect(client, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+	BME680_SystemClock clock;
+	uint64_t start = clock.micros();
+	BME680_CHECK(!server.poll(1000, 0));
+	uint64_t elapsed = clock.micros() - start;
+	BME680_CHECK(elapsed >= BME680_MetricsServer::REQUEST_TIMEOUT_MS * 1000u);
+	BME680_CHECK(elapsed < BME680_MetricsServer::REQUEST_TIMEOUT_MS * 2000u);
+	::close(client);
+
+	/* A request sent in pieces is still answered */
+	client = socket(AF_INET, SOCK_STREAM, 0);
+	BME680_CHECK(connect(client, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+	BME680_CHECK(send(client, "GET /met", 8, 0) == 8);
+	BME680_CHECK(send(client, "rics HTTP/1.0\r\n\r\n", 17, 0) == 17);
+	BME680_CHECK(server.poll(1000, 0));
+	char response[16] = { 0 };
+	BME680_CHECK(recv(client, response, 15, MSG_WAITALL) == 15);
+	BME680_CHECK(strcmp(response, "HTTP/1.0 200 OK") == 0);
+	::close(client);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(rendersInPlace)
+	BME680_TEST(silentClientBounded)
+)
@@ -0,0 +1,134 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_Oversampling.cpp
+ */
+
+#include <cmath>
+#include "BME680_Test.hpp"
+#include "BME680_Oversampling.hpp"
+#include "BME680_Simulator.hpp"
+#include "BME680_Timing.hpp"
+
+typedef BME680_Base B;
+typedef B::Ctrl_meas::osrs_t O;
+
+/* Temperature with white noise of sigma1 at X1, reduced by the current oversampling */
+struct Noise
+{
+	uint32_t state;
+
+	Noise() : state(31) {}
+
+	double uniform()
+	{
+		state = state * 1664525u + 1013904223u;
+		return ((state >> 8) + 0.5) / 16777216.0;
+	}
+
+	/* Box-Muller */
+	double gauss() { return std::sqrt(-2.0 * std::log(uniform())) * std::cos(2.0 * M_PI * uniform()); }
+
+	/* One window of samples, returns the result of the last update */
+	bool feed(BME680_OversamplingController &ctrl, double sigma1, uint16_t window)
+	{
+		bool changed = false;
+		for (uint16_t i = 0; i < window; i++)
+		{
+			double sigma = sigma1 / std::sqrt((double)BME680_Timing::factor(ctrl.osrs(BME680_Channel::TEMPERATURE)));
+			BME680_Sample s;
+			s.set(BME680_Channel::TEMPERATURE, 20.0 + sigma * gauss());
+			changed = ctrl.update(s);
+		}
+		return changed;
+	}
+};
+
+static const uint16_t WINDOW = 512;
+
+static BME680_OversamplingController controller()
+{
+	BME680_OversamplingController ctrl;
+	ctrl.setWindow(WINDOW);
+	ctrl.setNoiseBudget(BME680_Channel::TEMPERATURE, 0.01);
+	return ctrl;
+}
+
+static void stepsUpAtOnce()
+{
+	BME680_OversamplingController ctrl = controller();
+	Noise noise;
+	/* Quiet: down to X1 */
+	noise.feed(ctrl, 0.002, WINDOW);
+	BME680_CHECK(ctrl.osrs(BME680_Channel::TEMPERATURE) == O::X1);
+	/* 3 times the budget at X1 needs X16 (9 rounds up), in one decision */
+	BME680_CHECK(noise.feed(ctrl, 0.03, WINDOW));
+	BME680_CHECK(ctrl.osrs(BME680_Channel::TEMPERATURE) == O::X16);
+	BME680_CHECK(!noise.feed(ctrl, 0.03, WINDOW));
+}
+
+static void stepsDownWithMargin()
+{
+	BME680_OversamplingController ctrl = controller();
+	Noise noise;
+	/* X4 would just meet the budget, X8 keeps the noise below 0.75 of it */
+	BME680_CHECK(noise.feed(ctrl, 0.02, WINDOW));
+	BME680_CHECK(ctrl.osrs(BME680_Channel::TEMPERATURE) == O::X8);
+	BME680_CHECK(!noise.feed(ctrl, 0.02, WINDOW));
+	BME680_CHECK(ctrl.osrs(BME680_Channel::TEMPERATURE) == O::X8);
+}
+
+static void hysteresis()
+{
+	BME680_OversamplingController ctrl = controller();
+	Noise noise;
+	BME680_CHECK(noise.feed(ctrl, 0.02, WINDOW));
+	BME680_CHECK(ctrl.osrs(BME680_Channel::TEMPERATURE) == O::X8);
+	/* 0.6 of the budget at X8 (X4 would give 0.85): no step down */
+	for (int i = 0; i < 4; i++)
+		BME680_CHECK(!noise.feed(ctrl, 0.006 * std::sqrt(8.0), WINDOW));
+	BME680_CHECK(ctrl.osrs(BME680_Channel::TEMPERATURE) == O::X8);
+	/* 0.4 of the budget at X8 (X4 gives 0.57): one step down */
+	BME680_CHECK(noise.feed(ctrl, 0.004 * std::sqrt(8.0), WINDOW));
+	BME680_CHECK(ctrl.osrs(BME680_Channel::TEMPERATURE) == O::X4);
+	/* 0.8 of the budget at X4: still within the budget, kept */
+	BME680_CHECK(!noise.feed(ctrl, 0.008 * 2.0, WINDOW));
+	BME680_CHECK(ctrl.osrs(BME680_Channel::TEMPERATURE) == O::X4);
+}
+
+static void appliedThroughMeasurement()
+{
+	BME680_Simulator sim;
+	BME680_Measurement meas(sim);
+	BME680_OversamplingController ctrl = controller();
+	ctrl.setNoiseBudget(BME680_Channel::PRESSURE, 0.0);
+	ctrl.setNoiseBudget(BME680_Channel::HUMIDITY, 0.1);
+	Noise noise;
+	noise.feed(ctrl, 0.02, WINDOW);
+	ctrl.apply(meas);
+	/* Nothing is written before the next start */
+	BME680_CHECK(sim.transactions == 0);
+	uint32_t d = meas.start(BME680_Mode::TPH);
+	BME680_CHECK(d == ctrl.duration());
+	BME680_CHECK((sim.getCtrl_meas() & O::mask) >> 5 == O::X8);
+	BME680_CHECK((sim.getCtrl_meas() & B::Ctrl_meas::osrs_p::mask) == 0);
+	BME680_CHECK((sim.getCtrl_hum() & B::Ctrl_hum::osrs_h::mask) == O::X16);
+
+	/* A later choice reaches the device with the following start */
+	noise.feed(ctrl, 0.002, WINDOW);
+	ctrl.apply(meas);
+	sim.sleep(d);
+	meas.start(BME680_Mode::TPH);
+	BME680_CHECK((sim.getCtrl_meas() & O::mask) >> 5 == O::X1);
+	BME680_CHECK((sim.getCtrl_hum() & B::Ctrl_hum::osrs_h::mask) == O::X16);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(stepsUpAtOnce)
+	BME680_TEST(stepsDownWithMargin)
+	BME680_TEST(hysteresis)
+	BME680_TEST(appliedThroughMeasurement)
+)
@@ -0,0 +1,283 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_Shm.cpp
+ */
+
+#include <cstring>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "BME680_Test.hpp"
+#include "BME680_Shm.hpp"
+
+static const uint32_t CAPACITY = 8;
+
+/* Ring in ordinary memory, the same code runs on a shared memory segment */
+struct Ring
+{
+	uint64_t memory[4096];
+	BME680_ShmRing ring;
+
+	Ring() { BME680_CHECK(ring.attach(memory, BME680_ShmRing::size(CAPACITY), true)); }
+
+	void push(uint32_t id)
+	{
+		bme680_record r;
+		memset(&r, 0, sizeof(r));
+		r.sensor_id = id;
+		ring.push(r);
+	}
+};
+
+static void readsInOrder()
+{
+	Ring r;
+	uint32_t cursor = r.ring.head();
+	for (uint32_t i = 0; i < 5; i++)
+		r.push(i);
+	bme680_record record;
+	for (uint32_t i = 0; i < 5; i++)
+	{
+		BME680_CHECK(r.ring.read(cursor, record));
+		BME680_CHECK(record.sensor_id == i);
+	}
+	BME680_CHECK(!r.ring.read(cursor, record));
+}
+
+static void skipsLostRecords()
+{
+	Ring r;
+	uint32_t cursor = 0;
+	for (uint32_t i = 0; i < CAPACITY + 5; i++)
+		r.push(i);
+	bme680_record record;
+	BME680_CHECK(r.ring.read(cursor, record));
+	BME680_CHECK(record.sensor_id == 5);
+	BME680_CHECK(cursor == 6);
+}
+
+static void cursorAheadAfterInitialize()
+{
+	Ring r;
+	for (uint32_t i = 0; i < 20; i++)
+		r.push(i);
+	uint32_t cursor = r.ring.head();
+
+	/* The writer restarts and initializes the ring again, head is now below the cursor */
+	BME680_CHECK(r.ring.attach(r.memory, BME680_ShmRing::size(CAPACITY), true));
+	r.push(100);
+	r.push(101);
+	bme680_record record;
+	BME680_CHECK(r.ring.read(cursor, record));
+	BME680_CHECK(record.sensor_id == 100);
+	BME680_CHECK(r.ring.read(cursor, record));
+	BME680_CHECK(record.sensor_id == 101);
+	BME680_CHECK(!r.ring.read(cursor, record));
+}
+
+static void emptyAfterInitialize()
+{
+	Ring r;
+	for (uint32_t i = 0; i < 3; i++)
+		r.push(i);
+	uint32_t cursor = 1;
+	BME680_CHECK(r.ring.attach(r.memory, BME680_ShmRing::size(CAPACITY), true));
+	bme680_record record;
+	BME680_CHECK(!r.ring.read(cursor, record));
+}
+
+static void headWrapsAround()
+{
+	Ring r;
+	/* Writer that has already written almost 2^32 records: head is the word behind magic, version and capacity */
+	uint32_t *head = (uint32_t *)r.memory + 3;
+	*head = 0xfffffffc;
+	for (uint32_t i = 0; i < 10; i++)
+		r.push(i);
+	BME680_CHECK(r.ring.head() == 6);
+	BME680_CHECK(r.ring.oldest() == 0xfffffffe);
+
+	bme680_record record;
+	uint32_t cursor = r.ring.oldest();
+	for (uint32_t i = 2; i < 10; i++)
+	{
+		BME680_CHECK(r.ring.read(cursor, record));
+		BME680_CHECK(record.sensor_id == i);
+	}
+	BME680_CHECK(!r.ring.read(cursor, record));
+
+	/* A reader from before the wrap that lost two records */
+	cursor = 0xfffffffc;
+	BME680_CHECK(r.ring.read(cursor, record));
+	BME680_CHECK(record.sensor_id == 2 && cursor == 0xffffffff);
+	BME680_CHECK(r.ring.read(cursor, record));
+	BME680_CHECK(record.sensor_id == 3 && cursor == 0);
+}
+
+static void capacityPowerOfTwo()
+{
+	uint64_t memory[4096];
+	BME680_ShmRing ring;
+	BME680_CHECK(ring.attach(memory, BME680_ShmRing::size(12), true));
+	bme680_record record;
+	memset(&record, 0, sizeof(record));
+	for (uint32_t i = 0; i < 9; i++)
+		ring.push(record);
+	BME680_CHECK(ring.oldest() == 1);
+	BME680_CHECK(ring.attach(memory, BME680_ShmRing::size(12), false));
+	BME680_CHECK(ring.oldest() == 1);
+}
+
+/* Record whose 16 words all hold n, so a mix of two records is visible */
+static bme680_record pattern(uint32_t n)
+{
+	uint32_t w[BME680_RECORD_SIZE / 4];
+	for (uint32_t i = 0; i < BME680_RECORD_SIZE / 4; i++)
+		w[i] = n;
+	bme680_record r;
+	memcpy(&r, w, sizeof(r));
+	return r;
+}
+
+/* n of a pattern record, 0xffffffff if the words differ */
+static uint32_t number(const bme680_record &r)
+{
+	uint32_t w[BME680_RECORD_SIZE / 4];
+	memcpy(w, &r, sizeof(r));
+	for (uint32_t i = 1; i < BME680_RECORD_SIZE / 4; i++)
+		if (w[i] != w[0])
+			return 0xffffffff;
+	return w[0];
+}
+
+static void releaseSeesOverwrite()
+{
+	Ring r;
+	uint32_t cursor = 0;
+	r.push(0);
+	const bme680_record *p = r.ring.acquire(cursor);
+	BME680_CHECK(p && p->sensor_id == 0);
+	/* The writer laps the reader while it holds the pointer */
+	for (uint32_t i = 1; i <= CAPACITY; i++)
+		r.push(i);
+	BME680_CHECK(!r.ring.release(cursor));
+	/* The copying read retries from the oldest complete record */
+	bme680_record record;
+	cursor = 0;
+	BME680_CHECK(r.ring.read(cursor, record));
+	BME680_CHECK(record.sensor_id == 1 && cursor == 2);
+}
+
+struct TableReader
+{
+	const BME680_ShmTable *table;
+	bme680_record record;
+	uint32_t generation;
+	volatile bool done;
+};
+
+static void *readTable(void *arg)
+{
+	TableReader *t = (TableReader *)arg;
+	t->generation = t->table->read(0, t->record);
+	__atomic_store_n(&t->done, true, __ATOMIC_RELEASE);
+	return 0;
+}
+
+static void tableRetriesTornRead()
+{
+	uint64_t memory[64];
+	BME680_ShmTable table;
+	BME680_CHECK(table.attach(memory, BME680_ShmTable::size(1), true));
+	table.publish(0, pattern(1));
+
+	/* Writer stopped halfway through the second record: odd sequence, half of the bytes new */
+	uint32_t *seq = (uint32_t *)((uint8_t *)memory + 16); // Entry::seq of sensor 0 behind the 16 byte header
+	bme680_record *record = (bme680_record *)(seq + 2);
+	bme680_record next = pattern(2);
+	__atomic_store_n(seq, 3, __ATOMIC_RELEASE);
+	memcpy(record, &next, sizeof(next) / 2);
+
+	TableReader reader;
+	reader.table = &table;
+	reader.done = false;
+	pthread_t thread;
+	BME680_CHECK(pthread_create(&thread, 0, readTable, &reader) == 0);
+	usleep(20000);
+	BME680_CHECK(!__atomic_load_n(&reader.done, __ATOMIC_ACQUIRE));
+
+	memcpy(record, &next, sizeof(next));
+	__atomic_store_n(seq, 4, __ATOMIC_RELEASE);
+	pthread_join(thread, 0);
+	BME680_CHECK(reader.generation == 2 && number(reader.record) == 2);
+}
+
+static void concurrentWriterReader()
+{
+	static const uint32_t RECORDS = 200000;
+	char name[64];
+	snprintf(name, sizeof(name), "/bme680-test-%d", (int)getpid());
+	size_t size = BME680_ShmBroadcast::size(1, CAPACITY);
+	BME680_ShmSegment writer;
+	BME680_CHECK(writer.create(name, size));
+	BME680_ShmBroadcast shm;
+	BME680_CHECK(shm.attach(writer.memory(), size, 1, true));
+
+	pid_t child = fork();
+	if (child == 0)
+	{
+		for (uint32_t n = 1; n <= RECORDS; n++)
+			shm.publish(0, pattern(n));
+		_exit(0);
+	}
+	BME680_CHECK(child > 0);
+
+	/* Reader on its own read-only mapping */
+	BME680_ShmSegment segment;
+	BME680_CHECK(segment.open(name));
+	BME680_ShmSegment::unlink(name);
+	BME680_ShmBroadcast view;
+	BME680_CHECK(view.attach(segment.memory(), segment.size(), 0, false));
+
+	uint32_t mixed = 0, latest = 0, last = 0, reads = 0, cursor = 0;
+	bool running = true;
+	while (running)
+	{
+		running = waitpid(child, 0, WNOHANG) == 0;
+		bme680_record record;
+		uint32_t generation = view.latest().read(0, record);
+		if (generation)
+		{
+			uint32_t n = number(record);
+			mixed += n != generation;
+			BME680_CHECK(n >= latest);
+			latest = n;
+		}
+		while (view.history().read(cursor, record))
+		{
+			uint32_t n = number(record);
+			mixed += n == 0xffffffff || n <= last;
+			last = n;
+			reads++;
+		}
+	}
+	BME680_CHECK(mixed == 0);
+	BME680_CHECK(latest == RECORDS && last == RECORDS);
+	BME680_CHECK(reads > 0);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(readsInOrder)
+	BME680_TEST(skipsLostRecords)
+	BME680_TEST(cursorAheadAfterInitialize)
+	BME680_TEST(emptyAfterInitialize)
+	BME680_TEST(headWrapsAround)
+	BME680_TEST(capacityPowerOfTwo)
+	BME680_TEST(releaseSeesOverwrite)
+	BME680_TEST(tableRetriesTornRead)
+	BME680_TEST(concurrentWriterReader)
+)
@@ -0,0 +1,72 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_StaticConfig.cpp
+ */
+
+#include "BME680_Test.hpp"
+#include "BME680_StaticConfig.hpp"
+#include "BME680_Simulator.hpp"
+#include "BME680_Timing.hpp"
+
+typedef BME680_Base B;
+
+/* The compile-time values of a configuration against the run-time computation */
+template <class C>
+static void same(uint32_t waitMs)
+{
+	uint8_t code = C::gas ? BME680_Timing::gasWaitCode(waitMs) : 0;
+	BME680_CHECK(C::gas_wait == code);
+	BME680_CHECK(C::gasWaitMs == (C::gas ? BME680_Timing::gasWait(code) : 0));
+	BME680_CHECK(C::duration == BME680_Timing::tphg(C::osrs_t, C::osrs_p, C::osrs_h, C::gas) + C::gasWaitMs * 1000);
+}
+
+static void matchesTiming()
+{
+	same<BME680_StaticConfig<BME680_Osrs_t<1> > >(0);
+	same<BME680_StaticConfig<BME680_Osrs_t<2>, BME680_Osrs_p<5>, BME680_Osrs_h<1>, BME680_Filter<2> > >(0);
+	same<BME680_StaticConfig<BME680_Osrs_t<1>, BME680_Osrs_p<1>, BME680_Osrs_h<1>, BME680_Heater<0, 1> > >(1);
+	same<BME680_StaticConfig<BME680_Osrs_t<3>, BME680_Heater<2, 150> > >(150);
+	same<BME680_StaticConfig<BME680_Heater<9, 4031> > >(4031);
+	same<BME680_StaticConfig<BME680_Heater<9, 4032> > >(4032);
+}
+
+static void multiplierSteps()
+{
+	/* 63 ms is the last wait of factor 1, 64 ms the first of factor 4 */
+	typedef BME680_StaticConfig<BME680_Osrs_t<1>, BME680_Heater<0, 63> > A;
+	typedef BME680_StaticConfig<BME680_Osrs_t<1>, BME680_Heater<0, 64> > C;
+	typedef BME680_StaticConfig<BME680_Osrs_t<1>, BME680_Heater<0, 65> > D;
+	same<A>(63);
+	same<C>(64);
+	same<D>(65);
+	BME680_CHECK(A::gas_wait == 63 && A::gasWaitMs == 63);
+	BME680_CHECK(C::gas_wait == 0x50 && C::gasWaitMs == 64);
+	/* Rounded up to the next multiple of 4 */
+	BME680_CHECK(D::gasWaitMs == 68);
+	same<BME680_StaticConfig<BME680_Heater<0, 252> > >(252);
+	same<BME680_StaticConfig<BME680_Heater<0, 253> > >(253);
+	same<BME680_StaticConfig<BME680_Heater<0, 1008> > >(1008);
+	same<BME680_StaticConfig<BME680_Heater<0, 1009> > >(1009);
+	BME680_CHECK((BME680_StaticConfig<BME680_Heater<0, 4032> >::gas_wait == 0xff));
+}
+
+static void appliedToDevice()
+{
+	typedef BME680_StaticConfig<BME680_Osrs_t<2>, BME680_Osrs_h<3>, BME680_Filter<1>, BME680_Heater<4, 100> > C;
+	BME680_Simulator sim;
+	BME680_applyConfig<C>(sim, 0x73);
+	BME680_CHECK(sim.getGas_wait_4() == BME680_Timing::gasWaitCode(100));
+	BME680_CHECK(sim.getRes_heat_4() == 0x73);
+	BME680_CHECK(sim.getCtrl_meas() == C::ctrl_meas && sim.getCtrl_hum() == C::ctrl_hum);
+	BME680_CHECK(sim.getCtrl_gas_1() == C::ctrl_gas_1);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(matchesTiming)
+	BME680_TEST(multiplierSteps)
+	BME680_TEST(appliedToDevice)
+)
@@ -0,0 +1,138 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_Stats.cpp
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "BME680_Test.hpp"
+#include "BME680_Stats.hpp"
+
+static BME680_Sample temperature(uint32_t timestamp, double value)
+{
+	BME680_Sample s;
+	s.timestamp = timestamp;
+	s.set(BME680_Channel::TEMPERATURE, value);
+	return s;
+}
+
+static void moments()
+{
+	/* Large offset, small spread: the naive sum of squares loses all digits here */
+	BME680_RunningStats all, a, b;
+	std::vector<double> x;
+	for (uint32_t i = 0; i < 1000; i++)
+		x.push_back(1e9 + (i * 7919 % 1000) * 0.001);
+	double mean = 0.0, var = 0.0;
+	for (size_t i = 0; i < x.size(); i++)
+		mean += x[i] / x.size();
+	for (size_t i = 0; i < x.size(); i++)
+		var += (x[i] - mean) * (x[i] - mean) / (x.size() - 1);
+	for (size_t i = 0; i < x.size(); i++)
+	{
+		all.add(x[i]);
+		(i < 300 ? a : b).add(x[i]);
+	}
+	BME680_CHECK(all.count() == 1000);
+	BME680_CHECK(fabs(all.mean() - mean) < 1e-6);
+	BME680_CHECK(fabs(all.variance() - var) < 1e-6 * var);
+	BME680_CHECK(all.minimum() == 1e9 && all.maximum() == 1e9 + 0.999);
+
+	a.merge(b);
+	BME680_CHECK(a.count() == 1000);
+	BME680_CHECK(fabs(a.variance() - var) < 1e-6 * var);
+	BME680_CHECK(a.minimum() == all.minimum() && a.maximum() == all.maximum());
+}
+
+static void percentiles()
+{
+	BME680_ChannelStats t;
+	t.sketch.setRange(BME680_Range(-40.0, 85.0));
+	std::vector<double> x;
+	uint32_t state = 26;
+	for (uint32_t i = 0; i < 10000; i++)
+	{
+		state = state * 1664525u + 1013904223u;
+		x.push_back(15.0 + 10.0 * (state >> 8) / 16777216.0);
+		t.add(x.back());
+	}
+	std::sort(x.begin(), x.end());
+	/* Within a bin of the exact order statistic */
+	double bin = 125.0 / BME680_Histogram::BINS;
+	static const double q[5] = { 0.01, 0.1, 0.5, 0.9, 0.99 };
+	for (int i = 0; i < 5; i++)
+		BME680_CHECK(fabs(t.quantile(q[i]) - x[(size_t)(q[i] * (x.size() - 1))]) < bin);
+	BME680_CHECK(t.quantile(0.0) == x.front() && t.quantile(1.0) == x.back());
+
+	/* Logarithmic bins: relative error */
+	BME680_ChannelStats g;
+	g.sketch.setRange(BME680_StatsConfig().range[BME680_Channel::GAS]);
+	for (uint32_t i = 1; i <= 1000; i++)
+		g.add(1000.0 * i);
+	double ratio = std::pow(1e6, 1.0 / BME680_Histogram::BINS);
+	double median = g.quantile(0.5);
+	BME680_CHECK(median > 500000.0 / ratio && median < 500000.0 * ratio);
+}
+
+static void tumblingRollover()
+{
+	BME680_TumblingAggregator agg(1000);
+	BME680_WindowStats done;
+	BME680_CHECK(!agg.add(temperature(1500, 1.0), &done));
+	BME680_CHECK(!agg.add(temperature(1999, 3.0), &done));
+	BME680_CHECK(agg.add(temperature(2000, 10.0), &done));
+	BME680_CHECK(done.start == 1000 && done.channel[0].moments.count() == 2);
+	BME680_CHECK(done.channel[0].moments.mean() == 2.0);
+	BME680_CHECK(agg.current().start == 2000 && agg.current().channel[0].moments.count() == 1);
+
+	/* As a sink */
+	agg.add(temperature(3500, 4.0));
+	BME680_CHECK(agg.closed == 1 && agg.previous().start == 2000);
+	BME680_CHECK(agg.previous().channel[0].moments.mean() == 10.0);
+}
+
+static void slidingRollover()
+{
+	BME680_SlidingAggregator<4> agg(4000);
+	for (uint32_t t = 0; t < 8000; t += 100)
+		agg.add(temperature(t, t < 4000 ? 0.0 : 1.0));
+	const BME680_WindowStats &w = agg.query(7999);
+	BME680_CHECK(w.channel[0].moments.count() == 40);
+	BME680_CHECK(w.channel[0].moments.mean() == 1.0);
+	/* Half the window later only the last two panes are left */
+	BME680_CHECK(agg.query(9999).channel[0].moments.count() == 20);
+	/* A late sample goes to its pane */
+	agg.add(temperature(6050, 1.0));
+	BME680_CHECK(agg.query(7999).channel[0].moments.count() == 41);
+	/* Too late, dropped */
+	agg.add(temperature(3000, 1.0));
+	BME680_CHECK(agg.query(7999).channel[0].moments.count() == 41);
+}
+
+static void slidingAcrossWrap()
+{
+	/*
+	 * 2^32 is no multiple of the window: the pane after the wrap must neither
+	 * replace one that is still inside the window nor cut the last one short
+	 */
+	BME680_SlidingAggregator<5> agg(5000);
+	uint32_t t0 = 4294961000u;
+	for (uint32_t i = 0; i <= 70; i++)
+		agg.add(temperature(t0 + i * 100, 1.0));
+	uint32_t now = t0 + 7099;
+	BME680_CHECK(agg.query(now).channel[0].moments.count() == 41);
+	BME680_CHECK(agg.query(now + 2000).channel[0].moments.count() == 21);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(moments)
+	BME680_TEST(percentiles)
+	BME680_TEST(tumblingRollover)
+	BME680_TEST(slidingRollover)
+	BME680_TEST(slidingAcrossWrap)
+)
@@ -0,0 +1,128 @@
+/*
+ * name:        BME680
+ * description: Low-power gas, pressure, temperature and humidity sensor
+ * manuf:       Bosch Sensortec
+ * version:     0.1
+ * url:         https://ae-bst.resource.bosch.com/media/_tech/media/datasheets/BST-BME680-DS001-00.pdf
+ * file:        tests/test_Transport.cpp
+ */
+
+#include "BME680_Test.hpp"
+#include "BME680_Transport.hpp"
+#include "BME680_Simulator.hpp"
+
+typedef BME680_ResilientTransport R;
+
+/* Simulator behind a faulty bus and the retry/breaker layer, on the simulator's clock */
+struct Stack
+{
+	BME680_Simulator sim;
+	BME680_FaultyTransport faulty;
+	BME680_BusStats stats;
+	R resilient;
+
+	Stack() : faulty(sim), stats(), resilient(faulty, sim, &stats) {}
+
+	uint8_t read()
+	{
+		uint8_t id;
+		return resilient.read(BME680_Base::Id::__address, &id, 1);
+	}
+};
+
+static void retriesRecover()
+{
+	Stack s;
+	s.faulty.failNext(2);
+	uint64_t start = s.sim.micros();
+	BME680_CHECK(s.read() == BME680_Status::OK);
+	BME680_CHECK(s.faulty.attempts == 3);
+	/* Backoff 500 us, then 1000 us */
+	BME680_CHECK(s.sim.micros() - start == 1500);
+	BME680_CHECK(s.stats.retries == 2 && s.stats.errors == 2 && s.stats.transactions == 3);
+	BME680_CHECK(s.resilient.state() == R::CLOSED);
+}
+
+static void retriesAreBounded()
+{
+	Stack s;
+	s.resilient.setRetry(4, 1000, 3000);
+	s.faulty.failNext(10, BME680_Status::TIMEOUT);
+	uint64_t start = s.sim.micros();
+	BME680_CHECK(s.read() == BME680_Status::TIMEOUT);
+	BME680_CHECK(s.faulty.attempts == 5);
+	/* 1000 + 2000 + 3000 + 3000 us */
+	BME680_CHECK(s.sim.micros() - start == 9000);
+	/* One failed transaction does not open the circuit */
+	BME680_CHECK(s.resilient.state() == R::CLOSED);
+}
+
+static void breakerOpensAndRecovers()
+{
+	Stack s;
+	s.faulty.setDead();
+	for (int i = 0; i < 3; i++)
+		BME680_CHECK(s.read() == BME680_Status::NACK);
+	BME680_CHECK(s.resilient.state() == R::OPEN);
+
+	/* An open circuit does not touch the bus */
+	uint32_t attempts = s.faulty.attempts;
+	BME680_CHECK(s.read() == BME680_Status::CIRCUIT_OPEN);
+	BME680_CHECK(s.faulty.attempts == attempts);
+
+	/* After 1 s a single trial, its failure opens the circuit for 2 s */
+	s.sim.sleep(1000000);
+	BME680_CHECK(s.resilient.state() == R::HALF_OPEN);
+	BME680_CHECK(s.read() == BME680_Status::NACK);
+	BME680_CHECK(s.faulty.attempts == attempts + 1);
+	BME680_CHECK(s.resilient.state() == R::OPEN);
+	s.sim.sleep(1000000);
+	BME680_CHECK(s.resilient.state() == R::OPEN);
+	s.sim.sleep(1000000);
+	BME680_CHECK(s.resilient.state() == R::HALF_OPEN);
+
+	/* A successful trial closes the circuit */
+	s.faulty.setDead(BME680_Status::OK);
+	BME680_CHECK(s.read() == BME680_Status::OK);
+	BME680_CHECK(s.resilient.state() == R::CLOSED);
+}
+
+static void failureRate()
+{
+	Stack s;
+	/* 10 % of the transactions fail, 2 retries make a failed access about 1 in 1000 */
+	s.faulty.setFailureRate(6554, 7);
+	s.resilient.setBreaker(255, 1000000, 60000000);
+	uint32_t failed = 0;
+	for (int i = 0; i < 10000; i++)
+		failed += s.read() != BME680_Status::OK;
+	BME680_CHECK(s.faulty.failures > s.faulty.attempts / 20 && s.faulty.failures < s.faulty.attempts / 5);
+	BME680_CHECK(failed < 50);
+	BME680_CHECK(s.stats.errors == s.faulty.failures);
+}
+
+static void deviceKeepsFirstError()
+{
+	BME680_Simulator sim;
+	BME680_FaultyTransport faulty(sim);
+	BME680_TransportDevice dev(faulty);
+	BME680_CHECK(dev.getId() == 0x61);
+	BME680_CHECK(dev.status() == BME680_Status::OK);
+
+	faulty.failNext(1, BME680_Status::BUS_ERROR);
+	BME680_CHECK(dev.getId() == 0);
+	faulty.failNext(1, BME680_Status::NACK);
+	dev.setCtrl_hum(1);
+	BME680_CHECK(dev.status() == BME680_Status::BUS_ERROR);
+	dev.clearStatus();
+	BME680_CHECK(dev.getId() == 0x61);
+	BME680_CHECK(dev.status() == BME680_Status::OK);
+}
+
+BME680_TEST_MAIN(
+	BME680_TEST(retriesRecover)
+	BME680_TEST(retriesAreBounded)
+	BME680_TEST(breakerOpensAndRecovers)
+	BME680_TEST(failureRate)
+	BME680_TEST(deviceKeepsFirstError)
+)